@@ -25,22 +25,71 @@
 /*-----------------------------------------------------------------------------------------------*/
 #include <Arduino.h> 
 
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define APP_MAX_TASKS 8
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct AppTaskStats {
+  const char* name;
+  uint32_t periodUs;
+  uint32_t deadlineUs;        // Relative to the release time
+  uint8_t priority;           // 0 is the most urgent
+  uint32_t releases;          // Periods elapsed, including skipped ones
+  uint32_t runs;
+  uint32_t overruns;          // Deadline misses plus releases skipped to catch up
+  uint32_t maxJitterUs;       // Start time minus release time
+  uint64_t totalJitterUs;
+  uint32_t maxExecutionUs;
+  uint64_t totalExecutionUs;
+};
+
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
+/**
+ * Applications either override onLoop(), which run() calls back to back, or register periodic
+ * tasks in onStart() with addTask(). With tasks, run() becomes a non-preemptive time-triggered
+ * scheduler: the most urgent released task runs to completion, and when nothing is released
+ * the CPU idles until the next release. All time comes from micros(), so the host build
+ * schedules on its simulated clock and every run is reproducible.
+ */
 class App {
 public:
     App();
     virtual ~App();
     bool run();
     bool stop();
+
+    uint8_t getTaskCount() const;
+    bool getTaskStats(uint8_t taskId, AppTaskStats& stats) const;
+    uint16_t getCpuLoad() const;
     
 protected:
     virtual void onStart() = 0;
-    virtual void onLoop() = 0;
+    virtual void onLoop();
+    virtual void onTask(uint8_t taskId);
+
+    int8_t addTask(const char* name, uint32_t periodUs, uint32_t deadlineUs, uint8_t priority);
     
 private:
+    struct AppTask {
+      AppTaskStats stats;
+      uint32_t nextReleaseUs;
+    };
+
     bool isRunning;
+    AppTask tasks[APP_MAX_TASKS];
+    uint8_t taskCount;
+    uint32_t lastTickUs;
+    uint64_t elapsedUs;
+    uint64_t busyUs;
+
+    void schedule();
+    void idle(uint32_t us);
 };
 
 #endif // APP_H
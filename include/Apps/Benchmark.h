@@ -0,0 +1,60 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Benchmark.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host Benchmark Application header file
+ * 
+ **************************************************************************************************
+ * 
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ * 
+ **************************************************************************************************
+ *
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "App.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class BionicArmApp : public App {
+public:
+  static BionicArmApp& getInstance();
+  
+protected:
+  void onStart() override;
+  void onLoop() override;
+
+private:
+  BionicArmApp();
+  ~BionicArmApp();
+  
+  static BionicArmApp* instance;
+
+  // One entry per benchmarked component, each prints its own report
+  static void benchmarkSpscRing();
+  static void benchmarkBiquad();
+  static void benchmarkClassifier();
+  static void benchmarkLatencyTrace();
+  static void benchmarkButtonMatrix();
+  static void benchmarkStaticHal();
+  static void benchmarkCommunication();
+  static void benchmarkCommandParser();
+  static void benchmarkWifi();
+  static void benchmarkTransport();
+  static void benchmarkCodec();
+  static void benchmarkPipeline();
+};
+
+#endif // BENCHMARK_H
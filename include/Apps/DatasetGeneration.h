@@ -24,8 +24,46 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "App.h"
-#include "EmgSensor.h"
+#include "EmgArray.h"
 #include "Communication.h"
+#include "SpscRing.h"
+#include "EmgFrame.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define DATASET_SAMPLES_PER_PACKET 100 // Upper bound, rounded down to whole scans
+#ifndef DATASET_CHANNELS
+#define DATASET_EMG_PINS {34}           // Electrodes recorded, in scan order
+#define DATASET_CHANNELS 1
+#endif
+#define DATASET_SCANS_PER_PACKET (DATASET_SAMPLES_PER_PACKET / DATASET_CHANNELS)
+#define DATASET_SAMPLE_RATE_HZ EMG_SAMPLE_RATE_HZ
+#define DATASET_ACQUISITION_BLOCK 10    // Scans moved from the ADC per acquisition step
+#define DATASET_ACQUISITION_PERIOD_US 1000
+#define DATASET_TRANSMISSION_PERIOD_US 10000
+#define DATASET_RING_SAMPLES 1024       // Buffering between acquisition and transmission
+#define DATASET_GAP_RECORDS 8           // Acquisition drops not yet seen by transmission
+#ifndef DATASET_LABEL
+#define DATASET_LABEL 1                 // Gesture id being recorded, override with -DDATASET_LABEL=n
+#endif
+#ifndef DATASET_FRAME_TYPE
+#define DATASET_FRAME_TYPE EMG_FRAME_TYPE_RICE  // EMG_FRAME_TYPE_SAMPLES for older receivers
+#endif
+
+static_assert(DATASET_CHANNELS >= 1 && DATASET_CHANNELS <= ADC_SCAN_MAX_CHANNELS,
+              "DATASET_CHANNELS must fit one ADC scan");
+static_assert(DATASET_SCANS_PER_PACKET * DATASET_CHANNELS + DATASET_ACQUISITION_BLOCK *
+              DATASET_CHANNELS <= DATASET_RING_SAMPLES, "Sample ring too small for a packet");
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+// Scans dropped by acquisition because the sample ring was full
+struct ScanGap {
+  uint32_t scan;              // Scans pushed to the ring before the gap
+  uint32_t dropped;           // Scans missing from the stream at that point
+};
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
@@ -36,7 +74,7 @@ public:
   
 protected:
   void onStart() override;
-  void onLoop() override;
+  void onTask(uint8_t taskId) override;
 
 private:
   BionicArmApp();
@@ -45,12 +83,36 @@ private:
   static BionicArmApp* instance;
   
   // Only EMG and Communication for dataset generation
-  EmgSensor* emgSensor;
+  EmgArray* emgArray;
   Communication* communication;
 
-  static bool toArray(uint16_t value, uint8_t* array);
-  bool createSample(uint8_t * emgData);
-  bool createPacket(uint8_t * packet, uint8_t * emgData, uint8_t  label);
+  // Acquisition produces interleaved scans into the ring, transmission consumes from it
+  SpscRing<uint16_t, DATASET_RING_SAMPLES> sampleRing;
+  // Where acquisition dropped scans, so transmission keeps the timestamps exact
+  SpscRing<ScanGap, DATASET_GAP_RECORDS> gapRing;
+
+  // One contiguous block per channel while filtering
+  uint16_t acquisitionBlock[DATASET_CHANNELS][DATASET_ACQUISITION_BLOCK];
+  int16_t filteredBlock[DATASET_CHANNELS][DATASET_ACQUISITION_BLOCK];
+  uint16_t* acquisitionChannels[DATASET_CHANNELS];
+  int16_t* filteredChannels[DATASET_CHANNELS];
+  uint16_t interleavedBlock[DATASET_ACQUISITION_BLOCK * DATASET_CHANNELS];
+  uint16_t samples[DATASET_SCANS_PER_PACKET * DATASET_CHANNELS];
+  uint16_t sequence;
+  uint32_t scanIndex;         // Scans since acquisition started, dropped ones included
+  uint32_t pushedScans;       // Acquisition side
+  uint32_t droppedScans;      // Acquisition side, not yet recorded in gapRing
+  uint32_t poppedScans;       // Transmission side
+  ScanGap nextGap;            // Transmission side, taken from gapRing but not yet reached
+  bool gapPending;
+  int8_t acquisitionTask;
+  int8_t transmissionTask;
+
+  void acquire();
+  void transmit();
+
+  bool createSample();
+  bool createPacket(uint8_t * packet, size_t packetSize, size_t& packetLength, uint8_t label);
 };
 
 #endif // DATASET_GENERATION_H 
\ No newline at end of file
@@ -25,6 +25,7 @@
 /*-----------------------------------------------------------------------------------------------*/
 #include "App.h"
 #include "BionicArm.h"
+#include "ICoreTask.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
@@ -35,7 +36,7 @@ public:
   
 protected:
   void onStart() override;
-  void onLoop() override;
+  void onTask(uint8_t taskId) override;
 
 private:
   BionicArmApp();
@@ -45,6 +46,16 @@ private:
   
   // Full functionality with BionicArm
   BionicArm* bionicArm;
+  int8_t acquisitionTask;
+  int8_t motionTask;
+  int8_t classificationTask;
+  int8_t telemetryTask;
+
+  // Acquisition on its own core with -DBIONIC_ARM_DUAL_CORE, nullptr otherwise
+  ICoreTask* acquisitionCore;
+
+  bool startAcquisitionCore();
+  static void acquisitionStep(void* context);
 };
 
 #endif // FULL_ARM_H 
\ No newline at end of file
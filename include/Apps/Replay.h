@@ -0,0 +1,89 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Replay.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host Replay Application header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Feeds a recording (EmgDataset file or raw DatasetGeneration capture, named by REPLAY_FILE)
+ * to the host ADC and runs the unmodified BionicArm tasks on it, on the FullArm schedule. The
+ * simulated clock jumps over idle time, so the replay runs as fast as the host CPU allows and
+ * every decision is identical from run to run. Telemetry goes to /dev/null through the real
+ * Communication path. At the end of the recording the application prints its throughput, the
+ * latency of every BionicArm stage and the timeline of decided gestures.
+ *
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "App.h"
+#include "BionicArm.h"
+#include <chrono>
+#include <vector>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct ReplayDecision {
+  uint64_t timeUs;          // Since the start of the recording
+  uint8_t gestureId;
+  uint16_t rms;
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class BionicArmApp : public App {
+public:
+  static BionicArmApp& getInstance();
+
+protected:
+  void onStart() override;
+  void onTask(uint8_t taskId) override;
+
+private:
+  BionicArmApp();
+  ~BionicArmApp();
+
+  static BionicArmApp* instance;
+
+  BionicArm* bionicArm;
+  int8_t acquisitionTask;
+  int8_t motionTask;
+  int8_t classificationTask;
+  int8_t telemetryTask;
+
+  // Recording, as 12-bit ADC samples
+  const char* path;
+  std::vector<uint16_t> recording;
+  uint32_t recordingRateHz;
+  uint64_t originUs;
+  bool started;
+  bool finished;
+
+  // Results
+  std::vector<ReplayDecision> timeline;
+  std::chrono::steady_clock::time_point wallStart;
+
+  bool loadRecording();
+  void recordDecision();
+  void report();
+
+  static uint16_t replaySource(uint8_t pin, uint64_t timeUs, void* context);
+};
+
+#endif // REPLAY_H
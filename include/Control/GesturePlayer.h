@@ -0,0 +1,89 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : GesturePlayer.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Table-driven gesture trajectories and keyframe interpolator header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * A gesture is one trajectory per finger: a short list of keyframes giving the motor speed
+ * (-255 opens, +255 closes) at a time after the gesture start. Between keyframes the speed is
+ * interpolated linearly, after the last keyframe it is held. A trajectory ramps from the speed
+ * the finger had when the gesture started, so switching gestures never steps the motor current.
+ * A finger without a trajectory ramps to a stop the same way, over GESTURE_STOP_RAMP_MS.
+ *
+ */
+
+#ifndef GESTURE_PLAYER_H
+#define GESTURE_PLAYER_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define GESTURE_FINGERS         5   // Thumb, index, middle, ring, pinky
+#define GESTURE_MAX_KEYFRAMES   4
+#define GESTURE_TABLE_SIZE      16
+#define GESTURE_SPEED_MAX       255
+#ifndef GESTURE_STOP_RAMP_MS
+#define GESTURE_STOP_RAMP_MS    100 // Time a finger without a trajectory takes to stop
+#endif
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct GestureKeyframe {
+  uint16_t timeMs;   // Since gesture start, increasing within a trajectory
+  int16_t speed;     // -GESTURE_SPEED_MAX .. GESTURE_SPEED_MAX
+};
+
+struct FingerTrajectory {
+  uint8_t count;     // 0 ramps the finger to a stop over GESTURE_STOP_RAMP_MS
+  GestureKeyframe keyframes[GESTURE_MAX_KEYFRAMES];
+};
+
+struct Gesture {
+  FingerTrajectory fingers[GESTURE_FINGERS];
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class GesturePlayer {
+
+public:
+  GesturePlayer();
+  bool load(uint8_t gestureId, const Gesture& gesture);
+  bool start(uint8_t gestureId, uint32_t nowMs);
+  bool update(uint32_t nowMs, int16_t* speeds);
+  bool active() const;
+  uint8_t current() const;
+  bool defined(uint8_t gestureId) const;
+
+private:
+  Gesture table[GESTURE_TABLE_SIZE];
+  int16_t startSpeeds[GESTURE_FINGERS];
+  int16_t speeds[GESTURE_FINGERS];
+  uint32_t startMs;
+  uint8_t currentGesture;
+  bool running;
+  bool started;
+
+  int16_t interpolate(uint8_t finger, uint32_t elapsedMs, bool& finished) const;
+};
+
+#endif // GESTURE_PLAYER_H
@@ -0,0 +1,54 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : GestureTable.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Default gesture table
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Indexed by gesture id. Each finger lists {timeMs, speed} keyframes, in the order thumb,
+ * index, middle, ring, pinky. Ids without an entry ramp every finger to a stop. Grips can be
+ * replaced at run time with GesturePlayer::load().
+ *
+ */
+
+#ifndef GESTURE_TABLE_H
+#define GESTURE_TABLE_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "GesturePlayer.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+// Close in 150 ms, then drop to a holding speed to limit the stall current
+#define GESTURE_CLOSE   { 3, { {150, 255}, {800, 255}, {1000, 80} } }
+// Open in 150 ms, then stop once the finger reached its end stop
+#define GESTURE_OPEN    { 3, { {150, -255}, {600, -255}, {700, 0} } }
+#define GESTURE_STOP    { 1, { {100, 0} } }
+
+static const Gesture defaultGestureTable[] = {
+  // 0: Fist
+  { { GESTURE_CLOSE, GESTURE_CLOSE, GESTURE_CLOSE, GESTURE_CLOSE, GESTURE_CLOSE } },
+  // 1: Peace sign
+  { { GESTURE_STOP, GESTURE_OPEN, GESTURE_OPEN, GESTURE_CLOSE, GESTURE_CLOSE } },
+  // 2: Open hand
+  { { GESTURE_OPEN, GESTURE_OPEN, GESTURE_OPEN, GESTURE_OPEN, GESTURE_OPEN } },
+  // 3: Pinch, the thumb waits for the index to come halfway
+  { { { 3, { {100, 0}, {300, 200}, {1000, 60} } },
+      { 3, { {200, 200}, {800, 200}, {1000, 60} } },
+      GESTURE_OPEN, GESTURE_OPEN, GESTURE_OPEN } },
+};
+
+#endif // GESTURE_TABLE_H
@@ -0,0 +1,184 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgDataset.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Columnar EMG dataset file, streaming writer and memory-mapped reader
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * File layout (version 1), all fields little endian, every block aligned on 64 bytes:
+ *
+ *   [file header, 64 bytes]
+ *   [segment 0][segment 1]...
+ *   [index: one EmgDatasetIndexEntry per segment]
+ *   [trailer, 64 bytes]
+ *
+ * A segment holds up to EMG_DATASET_SEGMENT_SAMPLES consecutive samples of one label, session
+ * and subject, stored as columns:
+ *
+ *   int16  channel 0 [n] ... int16 channel N-1 [n]   Zero-centred ADC samples
+ *   uint32 timestamps [n]                             Microseconds after the segment start
+ *   uint8  labels [n]                                 Gesture id of every sample
+ *
+ * The index at the end lists every segment with its label, session, subject, start time and
+ * file offset. It is written when the file is closed, so segments can be streamed to disk as
+ * they arrive. The reader maps the file and hands out pointers into the mapping: slicing a
+ * recording never copies or parses samples, and only the touched pages are read from disk.
+ *
+ * Host only: the reader needs mmap().
+ *
+ */
+
+#ifndef EMG_DATASET_H
+#define EMG_DATASET_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define EMG_DATASET_MAGIC           "EMGCOL1"   // 8 bytes with the terminator
+#define EMG_DATASET_TRAILER_MAGIC   "EMGIDX1"
+#define EMG_DATASET_VERSION         1
+#define EMG_DATASET_ALIGN           64
+#define EMG_DATASET_MAX_CHANNELS    16
+#define EMG_DATASET_SEGMENT_SAMPLES 65536       // Per channel
+#define EMG_DATASET_ANY             0xFFFFFFFFu // Query wildcard
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct EmgDatasetHeader {
+  char magic[8];
+  uint32_t version;
+  uint16_t channels;
+  uint16_t reserved;
+  uint32_t sampleRateHz;
+  uint8_t padding[44];
+};
+
+struct EmgDatasetIndexEntry {
+  uint64_t offset;          // Segment position in the file
+  uint64_t startUs;         // Time of the first sample
+  uint32_t sampleCount;     // Per channel
+  uint32_t session;
+  uint32_t subject;
+  uint8_t label;
+  uint8_t reserved[3];
+};
+
+struct EmgDatasetTrailer {
+  char magic[8];
+  uint64_t indexOffset;
+  uint64_t segmentCount;
+  uint64_t sampleCount;     // Per channel, over all segments
+  uint8_t padding[32];
+};
+
+static_assert(sizeof(EmgDatasetHeader) == EMG_DATASET_ALIGN, "Header must fill one block");
+static_assert(sizeof(EmgDatasetIndexEntry) == 32, "Index entries are 32 bytes on disk");
+static_assert(sizeof(EmgDatasetTrailer) == EMG_DATASET_ALIGN, "Trailer must fill one block");
+
+// Read-only view of contiguous elements inside the mapping
+template <typename T>
+struct EmgSpan {
+  const T* data;
+  size_t size;
+
+  const T& operator[](size_t i) const { return this->data[i]; }
+  const T* begin() const { return this->data; }
+  const T* end() const { return this->data + this->size; }
+};
+
+struct EmgSegment {
+  uint8_t label;
+  uint32_t session;
+  uint32_t subject;
+  uint64_t startUs;
+  EmgSpan<int16_t> channels[EMG_DATASET_MAX_CHANNELS];
+  EmgSpan<uint32_t> timestamps;
+  EmgSpan<uint8_t> labels;
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * Streaming writer. Samples are buffered until a segment is full or the label, session or
+ * subject changes, then written as one block of columns.
+ */
+class EmgDatasetWriter {
+
+public:
+  EmgDatasetWriter();
+  ~EmgDatasetWriter();
+  bool open(const char* path, uint16_t channels, uint32_t sampleRateHz);
+  bool append(uint8_t label, uint32_t session, uint32_t subject, uint64_t timestampUs,
+              const int16_t* interleaved, size_t count);
+  bool close();
+  uint64_t getSegmentCount() const;
+
+private:
+  FILE* file;
+  uint16_t channels;
+  uint32_t sampleRateHz;
+  uint64_t offset;
+  uint64_t sampleCount;
+  std::vector<EmgDatasetIndexEntry> index;
+
+  // Segment being filled
+  EmgDatasetIndexEntry current;
+  std::vector<int16_t> columns;     // channels x EMG_DATASET_SEGMENT_SAMPLES
+  std::vector<uint32_t> timestamps;
+  std::vector<uint8_t> labels;
+
+  bool flush();
+  bool write(const void* data, size_t size);
+  bool pad();
+};
+
+/**
+ * Memory-mapped reader. Spans stay valid until close().
+ */
+class EmgDatasetReader {
+
+public:
+  EmgDatasetReader();
+  ~EmgDatasetReader();
+  bool open(const char* path);
+  void close();
+  uint16_t getChannels() const;
+  uint32_t getSampleRateHz() const;
+  uint64_t getSegmentCount() const;
+  uint64_t getSampleCount() const;
+  bool getSegment(uint64_t segmentId, EmgSegment& segment) const;
+  size_t select(uint32_t label, uint32_t session, uint32_t subject,
+                std::vector<uint64_t>& segmentIds) const;
+
+  static bool isDataset(const char* path);
+  static size_t segmentBytes(uint16_t channels, uint32_t sampleCount);
+
+private:
+  const uint8_t* mapping;
+  size_t mappingSize;
+  const EmgDatasetHeader* header;
+  const EmgDatasetTrailer* trailer;
+  const EmgDatasetIndexEntry* index;
+};
+
+#endif // EMG_DATASET_H
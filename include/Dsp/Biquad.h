@@ -0,0 +1,211 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Biquad.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Fixed-point cascaded biquad filters with compile-time coefficient design
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Coefficients are Q2.30 integers produced by constexpr functions (RBJ audio cookbook
+ * formulas), so declaring them constexpr puts the final integers in flash and no float
+ * operation runs on target. Sections run in Direct Form I with a 64-bit accumulator; samples
+ * are carried with 8 extra fractional bits between sections to keep quantisation noise and
+ * limit cycles below one LSB of the 16-bit output.
+ *
+ */
+
+#ifndef BIQUAD_H
+#define BIQUAD_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define BIQUAD_COEFF_SHIFT  30  // Q2.30 coefficients
+#define BIQUAD_GUARD_BITS   8   // Extra fractional bits of the internal signal
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+// Normalised so that a0 = 1: y = b0 x0 + b1 x1 + b2 x2 - a1 y1 - a2 y2
+struct BiquadCoefficients {
+  int32_t b0;
+  int32_t b1;
+  int32_t b2;
+  int32_t a1;
+  int32_t a2;
+};
+
+template <size_t Sections>
+struct BiquadCascade {
+  BiquadCoefficients section[Sections];
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * Compile-time filter design. Every function is meant to initialise a constexpr variable.
+ */
+class BiquadDesign {
+
+public:
+  static constexpr BiquadCoefficients lowPass(double sampleRateHz, double cutoffHz,
+                                              double q = 0.70710678) {
+    return fromCookbook((1.0 - cosW0(sampleRateHz, cutoffHz)) / 2.0,
+                        1.0 - cosW0(sampleRateHz, cutoffHz),
+                        (1.0 - cosW0(sampleRateHz, cutoffHz)) / 2.0,
+                        sampleRateHz, cutoffHz, q);
+  }
+
+  static constexpr BiquadCoefficients highPass(double sampleRateHz, double cutoffHz,
+                                               double q = 0.70710678) {
+    return fromCookbook((1.0 + cosW0(sampleRateHz, cutoffHz)) / 2.0,
+                        -(1.0 + cosW0(sampleRateHz, cutoffHz)),
+                        (1.0 + cosW0(sampleRateHz, cutoffHz)) / 2.0,
+                        sampleRateHz, cutoffHz, q);
+  }
+
+  static constexpr BiquadCoefficients notch(double sampleRateHz, double centerHz, double q = 30.0) {
+    return fromCookbook(1.0, -2.0 * cosW0(sampleRateHz, centerHz), 1.0, sampleRateHz, centerHz, q);
+  }
+
+  // EMG band: 20 Hz high-pass (DC, motion artefacts), mains notch, 450 Hz low-pass.
+  // The low-pass corner is kept below Nyquist for low sample rates.
+  static constexpr BiquadCascade<3> emgPreset(double sampleRateHz, double mainsHz) {
+    return BiquadCascade<3>{{
+      highPass(sampleRateHz, 20.0),
+      notch(sampleRateHz, mainsHz),
+      lowPass(sampleRateHz, 450.0 < 0.45 * sampleRateHz ? 450.0 : 0.45 * sampleRateHz)
+    }};
+  }
+
+private:
+  static constexpr double pi = 3.14159265358979323846;
+
+  // Taylor series, accurate to double precision on [0, pi]
+  static constexpr double sine(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 14; n++) {
+      term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+      sum += term;
+    }
+    return sum;
+  }
+
+  static constexpr double cosine(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 14; n++) {
+      term *= -x * x / ((2.0 * n - 1.0) * (2.0 * n));
+      sum += term;
+    }
+    return sum;
+  }
+
+  static constexpr double w0(double sampleRateHz, double frequencyHz) {
+    return 2.0 * pi * frequencyHz / sampleRateHz;
+  }
+
+  static constexpr double cosW0(double sampleRateHz, double frequencyHz) {
+    return cosine(w0(sampleRateHz, frequencyHz));
+  }
+
+  static constexpr int32_t toFixed(double value) {
+    return (int32_t)(value * (double)(1L << BIQUAD_COEFF_SHIFT) + (value >= 0.0 ? 0.5 : -0.5));
+  }
+
+  static constexpr BiquadCoefficients fromCookbook(double b0, double b1, double b2,
+                                                   double sampleRateHz, double frequencyHz,
+                                                   double q) {
+    double alpha = sine(w0(sampleRateHz, frequencyHz)) / (2.0 * q);
+    double a0 = 1.0 + alpha;
+    return BiquadCoefficients{
+      toFixed(b0 / a0), toFixed(b1 / a0), toFixed(b2 / a0),
+      toFixed(-2.0 * cosW0(sampleRateHz, frequencyHz) / a0), toFixed((1.0 - alpha) / a0)
+    };
+  }
+};
+
+/**
+ * Cascade of Sections biquads applied independently to Channels channels. Each channel is
+ * processed as one contiguous block per call.
+ */
+template <size_t Sections, size_t Channels>
+class BiquadChain {
+
+public:
+  explicit BiquadChain(const BiquadCascade<Sections>& cascade) : cascade(cascade) {
+    reset();
+  }
+
+  void reset() {
+    for (size_t c = 0; c < Channels; c++) {
+      for (size_t s = 0; s < Sections; s++) {
+        this->state[c][s] = State{0, 0, 0, 0};
+      }
+    }
+  }
+
+  // in and out may be the same buffer
+  void process(size_t channel, const int16_t* in, int16_t* out, size_t count) {
+    if (channel >= Channels) {
+      return;
+    }
+    State* states = this->state[channel];
+    for (size_t i = 0; i < count; i++) {
+      int32_t x = (int32_t)in[i] * (1 << BIQUAD_GUARD_BITS);
+      for (size_t s = 0; s < Sections; s++) {
+        x = step(this->cascade.section[s], states[s], x);
+      }
+      int32_t y = x >> BIQUAD_GUARD_BITS;
+      out[i] = (int16_t)(y > INT16_MAX ? INT16_MAX : (y < INT16_MIN ? INT16_MIN : y));
+    }
+  }
+
+private:
+  struct State {
+    int32_t x1;
+    int32_t x2;
+    int32_t y1;
+    int32_t y2;
+  };
+
+  static constexpr int32_t limit = (int32_t)INT16_MAX << BIQUAD_GUARD_BITS;
+
+  static inline int32_t step(const BiquadCoefficients& k, State& st, int32_t x0) {
+    int64_t acc = (int64_t)k.b0 * x0 + (int64_t)k.b1 * st.x1 + (int64_t)k.b2 * st.x2 -
+                  (int64_t)k.a1 * st.y1 - (int64_t)k.a2 * st.y2;
+    int64_t y0 = (acc + ((int64_t)1 << (BIQUAD_COEFF_SHIFT - 1))) >> BIQUAD_COEFF_SHIFT;
+    if (y0 > limit) {
+      y0 = limit;
+    } else if (y0 < -limit) {
+      y0 = -limit;
+    }
+    st.x2 = st.x1;
+    st.x1 = x0;
+    st.y2 = st.y1;
+    st.y1 = (int32_t)y0;
+    return (int32_t)y0;
+  }
+
+  const BiquadCascade<Sections>& cascade;
+  State state[Channels][Sections];
+};
+
+#endif // BIQUAD_H
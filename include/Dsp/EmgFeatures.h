@@ -0,0 +1,87 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgFeatures.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Sliding-window EMG feature extractor header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Time-domain features over overlapping windows of zero-centred samples:
+ *   RMS  root mean square          MAV  mean absolute value
+ *   WL   waveform length           ZC   zero crossings
+ *   SSC  slope sign changes
+ * Every feature is a running integer sum updated in O(1) per sample: the newest sample's
+ * contribution is added and the contribution of the sample leaving the window is removed.
+ *
+ */
+
+#ifndef EMG_FEATURES_H
+#define EMG_FEATURES_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define EMG_FEATURES_HISTORY     512                        // Power of two
+#define EMG_FEATURES_MAX_WINDOW  (EMG_FEATURES_HISTORY - 1)
+#define EMG_FEATURES_COUNT       5
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct EmgFeatureVector {
+  uint16_t rms;   // Same unit as the samples
+  uint16_t mav;   // Same unit as the samples
+  uint32_t wl;    // Sum of absolute sample differences over the window
+  uint16_t zc;    // Count over the window
+  uint16_t ssc;   // Count over the window
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class EmgFeatures {
+
+public:
+  EmgFeatures(uint16_t windowLength, uint16_t hop, uint16_t threshold);
+  void reset();
+  bool push(int16_t sample, EmgFeatureVector& features);
+  size_t process(const int16_t* samples, size_t count, EmgFeatureVector* features, size_t maxFeatures);
+
+private:
+  int16_t history[EMG_FEATURES_HISTORY];
+  uint32_t index;        // Free running, wraps together with the history mask
+  uint16_t filled;       // Samples in the window, saturates at windowLength
+  uint16_t windowLength;
+  uint16_t hop;
+  uint16_t hopCount;
+  uint16_t threshold;   // Dead band against noise for ZC and SSC
+
+  uint64_t sumSquares;
+  uint32_t sumAbs;
+  uint32_t waveformLength;
+  uint16_t zeroCrossings;
+  uint16_t slopeChanges;
+
+  int16_t at(uint32_t index) const;
+  bool isZeroCrossing(int16_t previous, int16_t current) const;
+  bool isSlopeChange(int16_t previous, int16_t current, int16_t next) const;
+  void output(EmgFeatureVector& features) const;
+  static uint32_t isqrt(uint64_t value);
+};
+
+#endif // EMG_FEATURES_H
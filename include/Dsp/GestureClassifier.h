@@ -0,0 +1,84 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : GestureClassifier.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Quantized gesture classifier header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Maps one EMG feature vector to a gesture id with int8 weights and int32 accumulators:
+ *
+ *   x[f]  = clamp((feature[f] - featureOffset[f]) >> featureShift[f], -128, 127)
+ *   LDA   : score[k] = outputWeights[k] . x + outputBias[k]                  (hidden == 0)
+ *   MLP   : h[j] = clamp(relu(hiddenWeights[j] . x + hiddenBias[j]) >> hiddenShift, 0, 127)
+ *           score[k] = outputWeights[k] . h + outputBias[k]                  (hidden > 0)
+ *   gesture = argmax(score)
+ *
+ * Models are plain const structs generated by the ModelTrainer host tool, so they live in flash.
+ * Loop bounds only depend on the model dimensions and there is no data dependent branch besides
+ * the clamps, so the execution time of classify() is the same for every window.
+ *
+ */
+
+#ifndef GESTURE_CLASSIFIER_H
+#define GESTURE_CLASSIFIER_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "EmgFeatures.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define GESTURE_MAX_CLASSES  16
+#define GESTURE_MAX_HIDDEN   16
+#define GESTURE_MAX_INPUTS   (GESTURE_MAX_HIDDEN > EMG_FEATURES_COUNT ? \
+                              GESTURE_MAX_HIDDEN : EMG_FEATURES_COUNT)
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+// Feature order: rms, mav, wl, zc, ssc
+struct GestureModel {
+  uint8_t classes;                                          // Gesture ids 0 .. classes - 1
+  uint8_t hidden;                                           // 0 for LDA, hidden units for MLP
+  int32_t featureOffset[EMG_FEATURES_COUNT];
+  uint8_t featureShift[EMG_FEATURES_COUNT];
+  int8_t hiddenWeights[GESTURE_MAX_HIDDEN][EMG_FEATURES_COUNT];
+  int32_t hiddenBias[GESTURE_MAX_HIDDEN];
+  uint8_t hiddenShift;
+  int8_t outputWeights[GESTURE_MAX_CLASSES][GESTURE_MAX_INPUTS];
+  int32_t outputBias[GESTURE_MAX_CLASSES];
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class GestureClassifier {
+
+public:
+  explicit GestureClassifier(const GestureModel& model);
+  bool valid() const;
+  bool classify(const EmgFeatureVector& features, uint8_t& gestureId) const;
+  void quantize(const EmgFeatureVector& features, int8_t* inputs) const;
+
+private:
+  const GestureModel& model;
+
+  static int32_t dot(const int8_t* weights, const int8_t* inputs, uint8_t count);
+  static int8_t clampInt8(int32_t value, int32_t low);
+};
+
+#endif // GESTURE_CLASSIFIER_H
@@ -0,0 +1,41 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : GestureModelData.h
+ * @brief   : Gesture classifier model, generated by ModelTrainer, do not edit
+ *
+ **************************************************************************************************
+ *
+ * LDA model, 4 classes, trained on 2029 windows, quantized training accuracy 87.0 %
+ *
+ */
+
+#ifndef GESTURE_MODEL_DATA_H
+#define GESTURE_MODEL_DATA_H
+
+#include "GestureClassifier.h"
+
+// Feature extraction the model was trained with
+#define GESTURE_MODEL_WINDOW 200
+#define GESTURE_MODEL_HOP 50
+#define GESTURE_MODEL_THRESHOLD 20
+#define GESTURE_MODEL_MIN_RMS 200
+
+static const GestureModel gestureModel = {
+  4,  // classes
+  0,  // hidden
+  {402, 321, 71913, 76, 120},
+  {3, 2, 11, 0, 0},
+  {},
+  {},
+  0,  // hiddenShift
+  {
+    {-102, 49, 23, 55, 24},
+    {-106, 37, 73, 46, 24},
+    {127, -50, -71, -84, -28},
+    {42, -13, -28, -20, -10}
+  },
+  {-1140, -1271, -2443, -367}
+};
+
+#endif // GESTURE_MODEL_DATA_H
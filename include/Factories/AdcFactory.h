@@ -24,6 +24,7 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "IAdc.h"
+#include "IAdcScan.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
@@ -32,6 +33,7 @@ class AdcFactory {
  
 public:
   static IAdc* createAdc(uint8_t pin);
+  static IAdcScan* createAdcScan(const uint8_t* pins, uint8_t count);
 };
 
 #endif // ADC_FACTORY_H
\ No newline at end of file
@@ -1,44 +1,37 @@
 /**
  **************************************************************************************************
  *
- * @file    : ICommunication.h
+ * @file    : CoreTaskFactory.h
  * @author  : Oussama Darouez
  * @version : 1.0
- * @date    : February 2024
- * @brief   : Communication Interface header file
- * 
+ * @date    : October 2026
+ * @brief   : Core task Factory header file
+ *
  **************************************************************************************************
- * 
+ *
  * @project  : {BionicArm}
  * @board    : {esp32dev}
  * @compiler : {gcc-arm-none-eabi}
- * 
+ *
  **************************************************************************************************
  *
  */
 
-#ifndef ICOMMUNICATION_H
-#define ICOMMUNICATION_H
+#ifndef CORE_TASK_FACTORY_H
+#define CORE_TASK_FACTORY_H
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
-#include <Arduino.h>
+#include "ICoreTask.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class ICommunication {
-public:
-    virtual ~ICommunication() = default;
-
-    virtual bool setup() = 0;
+class CoreTaskFactory {
 
-
-    virtual int sendData(const uint8_t* data, size_t length) = 0;
-
-
-    virtual int receiveData(uint8_t* buffer, size_t maxLength) = 0;
+public:
+  static ICoreTask* createCoreTask(const char* name, uint8_t core, uint8_t priority);
 };
 
-#endif // ICOMMUNICATION_H
+#endif // CORE_TASK_FACTORY_H
@@ -24,6 +24,7 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "IGpio.h"
+#include "IGpioPort.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
@@ -32,6 +33,7 @@ class GpioFactory {
  
 public:
   static IGpio* createGpio(uint8_t pin, uint8_t mode);
+  static IGpioPort* createGpioPort(const uint8_t* pins, uint8_t count, uint8_t mode);
 };
 
 #endif // GPIO_FACTORY_H 
\ No newline at end of file
@@ -24,6 +24,7 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "IPwm.h"
+#include "IPwmGroup.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
@@ -32,6 +33,7 @@ class PwmFactory {
  
 public:
   static IPwm* createPwm(uint8_t pin);
+  static IPwmGroup* createPwmGroup(const uint8_t* pins, uint8_t count);
 };
 
 #endif // PWM_FACTORY_H 
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : StaticHal.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Compile-time selection of the hardware drivers
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Static counterpart of the factories. Instead of allocating a driver and returning it as an
+ * interface pointer, it names the driver class of the platform being built. Modules taking the
+ * driver as a template parameter (StaticEmgSensor, StaticMotorDriver) hold it by value: no arena
+ * allocation, and since every driver class is final each call is a direct call the compiler
+ * may inline. The factories and interfaces stay for code that chooses drivers at run time.
+ * The arena budgets of the applications are also computed from these types.
+ *
+ */
+
+#ifndef STATIC_HAL_H
+#define STATIC_HAL_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IWifi.h"
+#ifdef ARDUINO_ARCH_STM32
+  #include "Stm32Adc.h"
+  #include "Stm32Pwm.h"
+  #include "Stm32Gpio.h"
+  #include "Stm32AdcScan.h"
+  #include "Stm32PwmGroup.h"
+  #include "Stm32GpioPort.h"
+  #include "Stm32Serial.h"
+#elif defined(ARDUINO_ARCH_ESP32)
+  #include "Esp32Adc.h"
+  #include "Esp32Pwm.h"
+  #include "Esp32Gpio.h"
+  #include "Esp32AdcScan.h"
+  #include "Esp32PwmGroup.h"
+  #include "Esp32GpioPort.h"
+  #include "Esp32Serial.h"
+  #include "Esp32Wifi.h"
+  #include "Esp32CoreTask.h"
+#elif defined(HOST_NATIVE)
+  #include "HostAdc.h"
+  #include "HostPwm.h"
+  #include "HostGpio.h"
+  #include "HostAdcScan.h"
+  #include "HostPwmGroup.h"
+  #include "HostGpioPort.h"
+  #include "HostSerial.h"
+  #include "HostWifi.h"
+  #include "HostCoreTask.h"
+#endif
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+#ifdef ARDUINO_ARCH_STM32
+  typedef Stm32Adc PlatformAdc;
+  typedef Stm32Pwm PlatformPwm;
+  typedef Stm32Gpio PlatformGpio;
+  typedef Stm32AdcScan PlatformAdcScan;
+  typedef Stm32PwmGroup PlatformPwmGroup;
+  typedef Stm32GpioPort PlatformGpioPort;
+  typedef Stm32Serial PlatformSerial;
+#elif defined(ARDUINO_ARCH_ESP32)
+  typedef Esp32Adc PlatformAdc;
+  typedef Esp32Pwm PlatformPwm;
+  typedef Esp32Gpio PlatformGpio;
+  typedef Esp32AdcScan PlatformAdcScan;
+  typedef Esp32PwmGroup PlatformPwmGroup;
+  typedef Esp32GpioPort PlatformGpioPort;
+  typedef Esp32Serial PlatformSerial;
+  typedef Esp32Wifi PlatformWifi;
+  typedef Esp32CoreTask PlatformCoreTask;
+#elif defined(HOST_NATIVE)
+  typedef HostAdc PlatformAdc;
+  typedef HostPwm PlatformPwm;
+  typedef HostGpio PlatformGpio;
+  typedef HostAdcScan PlatformAdcScan;
+  typedef HostPwmGroup PlatformPwmGroup;
+  typedef HostGpioPort PlatformGpioPort;
+  typedef HostSerial PlatformSerial;
+  typedef HostWifi PlatformWifi;
+  typedef HostCoreTask PlatformCoreTask;
+#else
+  #error "StaticHal.h: no driver for this platform, use the factories"
+#endif
+
+// Driver behind Communication
+#ifdef COMM_WIFI_LINK
+  typedef PlatformWifi PlatformLink;
+#else
+  typedef PlatformSerial PlatformLink;
+#endif
+
+#endif // STATIC_HAL_H
@@ -0,0 +1,37 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : WifiFactory.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : WiFi Factory header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef WIFI_FACTORY_H
+#define WIFI_FACTORY_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IWifi.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class WifiFactory {
+
+public:
+  static IWifi* createWifi(uint16_t localPort, uint16_t remotePort);
+};
+
+#endif // WIFI_FACTORY_H
@@ -36,6 +36,15 @@ public:
 
     virtual bool read(uint16_t& value) = 0;
 
+    // Continuous mode: the hardware samples at a fixed rate and readBlock() returns the
+    // samples converted since the previous call, without waiting for more. read() is not
+    // available while continuous mode is running.
+    virtual bool startContinuous(uint32_t sampleRateHz) = 0;
+
+    virtual bool stopContinuous() = 0;
+
+    virtual bool readBlock(uint16_t* dst, size_t n, size_t& samplesRead) = 0;
+
 };
 
 #endif // IADC_H
@@ -0,0 +1,57 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : IAdcScan.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Multi-channel ADC scan interface
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef IADC_SCAN_H
+#define IADC_SCAN_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <Arduino.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define ADC_SCAN_MAX_CHANNELS 8   // ADC1 inputs of the ESP32
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * A scan converts every pin once, in pin order, and scans repeat at a fixed rate. The hardware
+ * produces interleaved conversions, readScans() hands them out de-interleaved: one contiguous
+ * array per channel (structure of arrays) plus the time of each scan. Channel c of a scan is
+ * converted c conversion slots after the scan timestamp.
+ */
+class IAdcScan {
+
+public:
+  virtual ~IAdcScan() = default;
+  virtual bool setup() = 0;
+  virtual uint8_t channelCount() const = 0;
+  virtual bool startScan(uint32_t scanRateHz) = 0;
+  virtual bool stopScan() = 0;
+
+  // Never waits: returns the scans completed since the previous call, at most maxScans.
+  // channels[c][i] receives channel c of scan i, timestampsUs[i] its time (may be nullptr).
+  virtual bool readScans(uint16_t* const* channels, uint32_t* timestampsUs, size_t maxScans,
+                         size_t& scansRead) = 0;
+};
+
+#endif // IADC_SCAN_H
\ No newline at end of file
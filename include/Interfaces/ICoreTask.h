@@ -0,0 +1,57 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : ICoreTask.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Core task interface header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * A task pinned to one CPU core that calls a step function periodically, next to the App
+ * scheduler running on another core. The step runs in its own context, so everything it
+ * shares with the other core must go through lock-free queues (SpscRing). The core, priority
+ * and name are given to the factory, the step and period to start().
+ *
+ */
+
+#ifndef ICORE_TASK_H
+#define ICORE_TASK_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+typedef void (*CoreTaskStep)(void* context);
+
+struct CoreTaskStats {
+  uint32_t steps;
+  uint32_t overruns;    // Periods started late because the previous step ran too long
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class ICoreTask {
+
+public:
+  virtual ~ICoreTask() = default;
+  // Calls step(context) every periodUs until stop(), back to back with a period of 0
+  virtual bool start(CoreTaskStep step, void* context, uint32_t periodUs) = 0;
+  // Returns once the step in progress, if any, has completed
+  virtual bool stop() = 0;
+  virtual bool getStats(CoreTaskStats& stats) const = 0;
+};
+
+#endif // ICORE_TASK_H
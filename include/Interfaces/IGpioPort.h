@@ -0,0 +1,62 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : IGpioPort.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : GPIO Port Interface header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef IGPIO_PORT_H
+#define IGPIO_PORT_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IGpio.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define GPIO_PORT_MAX_PINS 32
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+typedef void (*GpioCallback)(void* context);
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * A set of pins of the same mode accessed together. Bit i of every mask stands for the i-th
+ * pin given to the constructor, whatever its position in the hardware registers. A read or a
+ * write is one register access per hardware port touched, not one call per pin.
+ */
+class IGpioPort {
+
+public:
+  virtual ~IGpioPort() = default;
+  virtual bool setup() = 0;
+  virtual uint8_t pinCount() const = 0;
+
+  // Pins selected by mask take their bit of levels, the other pins keep their level
+  virtual bool write(uint32_t mask, uint32_t levels) = 0;
+  virtual bool read(uint32_t& levels) = 0;
+
+  // Input ports only. The callback runs in interrupt context when any pin changes level.
+  virtual bool attachChangeInterrupt(GpioCallback callback, void* context) = 0;
+  virtual bool detachChangeInterrupt() = 0;
+};
+
+#endif // IGPIO_PORT_H
@@ -0,0 +1,43 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : IPwmGroup.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : PWM channel group interface
+ * 
+ **************************************************************************************************
+ * 
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ * 
+ **************************************************************************************************
+ *
+ */
+
+#ifndef IPWM_GROUP_H 
+#define IPWM_GROUP_H 
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <Arduino.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class IPwmGroup {
+ 
+public:
+  virtual ~IPwmGroup() = default;
+  virtual bool setup() = 0;
+  virtual uint8_t channelCount() const = 0;
+
+  // stage() only records the duty cycle, commit() applies every staged duty at once
+  virtual bool stage(uint8_t channel, uint8_t dutyCycle) = 0;
+  virtual bool commit() = 0;
+};
+
+#endif // IPWM_GROUP_H 
@@ -15,6 +15,10 @@
  * 
  **************************************************************************************************
  *
+ * Byte stream link. writeSpans() may accept only part of the bytes, bytesWritten tells how
+ * many; availableForWrite() reports how many fit the driver buffer without waiting. The UART
+ * drains on its own, update() has nothing to do.
+ *
  */
 
 #ifndef ISERIAL_H 
@@ -24,17 +28,12 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include <Arduino.h>
+#include "ITransport.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class ISerial {
- 
-public:
-  virtual ~ISerial() = default;
-  virtual bool setup() = 0;
-  virtual bool writeData(const uint8_t* data, size_t length, size_t& bytesWritten) = 0;
-  virtual bool readData(uint8_t* buffer, size_t length, size_t& bytesRead) = 0;
+class ISerial : public ITransport {
 };
 
 #endif // ISERIAL_H 
\ No newline at end of file
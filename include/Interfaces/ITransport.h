@@ -0,0 +1,71 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : ITransport.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Transport Interface header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * The one contract of every link: the serial and WiFi drivers, and Communication on top of
+ * them. writeSpans() is a gather write: the spans are sent in order as one frame, so a header,
+ * a payload and a trailer held in different buffers are never assembled by the caller. On a
+ * datagram link the frame stays in one datagram. writeData() is the single span case.
+ *
+ */
+
+#ifndef ITRANSPORT_H
+#define ITRANSPORT_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct TransportSpan {
+  const uint8_t* data;
+  size_t length;
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class ITransport {
+
+public:
+  virtual ~ITransport() = default;
+  virtual bool setup() = 0;
+  virtual bool writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) = 0;
+  virtual bool readData(uint8_t* buffer, size_t length, size_t& bytesRead) = 0;
+  // Bytes writeSpans() accepts right now without waiting
+  virtual bool availableForWrite(size_t& space) = 0;
+  // Moves pending data towards the link, call periodically
+  virtual bool update() = 0;
+
+  bool writeData(const uint8_t* data, size_t length, size_t& bytesWritten) {
+    TransportSpan span = { data, length };
+    return this->writeSpans(&span, 1, bytesWritten);
+  }
+
+  static size_t totalLength(const TransportSpan* spans, size_t count) {
+    size_t length = 0;
+    for (size_t i = 0; i < count; i++) {
+      length += spans[i].length;
+    }
+    return length;
+  }
+};
+
+#endif // ITRANSPORT_H
@@ -15,6 +15,11 @@
  * 
  **************************************************************************************************
  *
+ * Datagram link. writeSpans() gathers each frame into the current datagram, which is sent when
+ * the next frame does not fit or when its oldest frame has waited WIFI_FLUSH_DEADLINE_US.
+ * update() checks that deadline and must be called periodically. Neither call waits for the
+ * radio: a datagram the network stack cannot take is dropped and counted.
+ *
  */
 
 #ifndef IWIFI_H 
@@ -23,18 +28,32 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
-#include<Arduino.h> 
+#include <Arduino.h>
+#include "ITransport.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#ifndef WIFI_FLUSH_DEADLINE_US
+#define WIFI_FLUSH_DEADLINE_US 5000   // Longest a frame waits for others, 0 sends every frame
+#endif
+#ifndef WIFI_LOCAL_PORT
+#define WIFI_LOCAL_PORT 4210          // UDP port the arm listens on
+#endif
+#ifndef WIFI_REMOTE_PORT
+#define WIFI_REMOTE_PORT 4211         // UDP port frames are sent to
+#endif
+
+// Set when Communication runs over WiFi: requested with WIFI_COMMUNICATION, and the STM32 has
+// no radio so it keeps the serial link whatever the flag says
+#if defined(WIFI_COMMUNICATION) && !defined(ARDUINO_ARCH_STM32)
+#define COMM_WIFI_LINK
+#endif
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class IWifi {
- 
-public:
-  virtual ~IWifi() = default;
-  virtual bool setup() = 0;
-  virtual size_t writeData(const uint8_t* data, size_t length) = 0;
-  virtual size_t readData(uint8_t* buffer, size_t length) = 0;
+class IWifi : public ITransport {
 };
 
-#endif // IWIFI_H 
\ No newline at end of file
+#endif // IWIFI_H
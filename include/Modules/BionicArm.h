@@ -17,18 +17,69 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "EmgSensor.h"
-#include "MotorDriver.h"
+#include "MotorBank.h"
 #include "ButtonMatrix.h"
 #include "Communication.h"
+#include "EmgFeatures.h"
+#include "GestureClassifier.h"
+#include "GesturePlayer.h"
+#include "LatencyTrace.h"
+#include "SpscRing.h"
+#include "CommandFrame.h"
+#include "StaticArena.h"
+#include "StaticHal.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Constants                                                                                     */
 /*-----------------------------------------------------------------------------------------------*/
 #define NUM_MOTORS 5
-#define EMG_THRESHOLD 2048  // Adjust based on your EMG sensor
+#define EMG_BLOCK_SIZE 10         // Samples taken from the sensor per loop iteration
+#define EMG_WINDOW 200            // Feature window: 200 ms
+#define EMG_HOP 50                // New feature vector every 50 ms
+#define EMG_DEAD_BAND 20          // Noise dead band for zero crossings and slope changes
+#define EMG_ACTIVATION_RMS 200    // Adjust based on your EMG sensor
 #define MATRIX_ROWS 3
 #define MATRIX_COLS 3
 
+// Commands accepted on the link, see CommandFrame.h for the frame format
+#define COMMAND_SET_THRESHOLD     0x01    // uint16: activation RMS
+#define COMMAND_TRIGGER_GESTURE   0x02    // uint8: gesture id, started at once
+#define COMMAND_STREAM            0x03    // uint8: 0 stops gesture telemetry, 1 restarts it
+#define COMMAND_QUERY_STATS       0x04    // No payload, the answer is followed by the report
+#define COMMAND_BYTES_PER_STEP    64      // Received bytes parsed per telemetry step, at most
+
+// Frames sent by the arm on its own, in the COMMAND_TELEMETRY range
+#define TELEMETRY_GESTURE         0x40    // uint8 gesture id, uint16 RMS
+#define TELEMETRY_REPORT          0x41    // Up to COMMAND_MAX_PAYLOAD bytes of report text
+#define TELEMETRY_REPORT_END      0x42    // No payload, the report is complete
+#define REPORT_LINE_IDLE          0xFF    // No latency report being sent
+
+// Periods of the control steps when an application schedules them as tasks
+#define ACQUISITION_PERIOD_US     1000    // 1 kHz, drains the ADC ahead of its buffer
+#define MOTION_PERIOD_US          10000   // 100 Hz trajectory interpolation
+#define CLASSIFICATION_PERIOD_US  20000   // 50 Hz, picks up each new feature window
+#define TELEMETRY_PERIOD_US       10000   // 100 Hz
+
+// Dual-core split (-DBIONIC_ARM_DUAL_CORE): acquire() alone on ACQUISITION_CORE, the other
+// steps on the core running App::run(), core 1 for the Arduino loop task of the ESP32
+#define ACQUISITION_CORE          0
+#define ACQUISITION_PRIORITY      5       // Above the Arduino loop task (1)
+#define FEATURE_QUEUE_WINDOWS     8       // 400 ms of windows between acquire() and classify()
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+enum BionicArmStage : uint8_t {
+  STAGE_EMG,        // processEmgSignal()
+  STAGE_BUTTONS,    // Button matrix events
+  STAGE_CLASSIFIER, // Gesture classifier
+  STAGE_EXECUTE,    // executeGesture()
+  STAGE_MOTORS,     // updateMotors()
+  STAGE_SEND,       // sendGestureData()
+  STAGE_COMMANDS,   // Received bytes parsed and commands handled
+  STAGE_COUNT
+};
+
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
@@ -42,18 +93,73 @@ public:
   ~BionicArm();
   bool setup();
   bool doGesture();
+
+  // Steps of doGesture(), for callers scheduling them at their own rates
+  bool acquire();
+  bool classify();
+  bool updateMotors();
+  bool sendTelemetry();
+  bool serviceRequests();
+  const LatencyTrace& getTrace() const;
+  bool getLastGesture(uint8_t& gestureId, uint16_t& rms) const;
+  uint32_t getDroppedWindows() const;
   
 private:
   // Components
   EmgSensor* emg;
-  MotorDriver* motors[NUM_MOTORS];
+  MotorBank* motors;
   ButtonMatrix* buttonMatrix;
   Communication* communication;
 
+  // EMG processing
+  EmgFeatures features;
+  GestureClassifier classifier;
+  uint16_t emgBlock[EMG_BLOCK_SIZE];
+  int16_t filteredBlock[EMG_BLOCK_SIZE];
+  EmgFeatureVector latestFeatures;
+  // Only link between acquire() and classify(), which may run on different cores
+  SpscRing<EmgFeatureVector, FEATURE_QUEUE_WINDOWS> featureQueue;
+
+  // Motion
+  GesturePlayer player;
+  int16_t motorSpeeds[NUM_MOTORS];
+
+  // Telemetry
+  bool telemetryPending;
+  bool hasGesture;
+  uint8_t lastGesture;
+  uint16_t lastRms;
+
+  // Instrumentation
+  LatencyTrace trace;
+
+  // Commands received on the link
+  static const CommandHandler commandHandlers[];
+  CommandParser commands;
+  uint16_t activationRms;
+  bool streaming;
+  uint8_t reportLine;       // Next latency report line, REPORT_LINE_IDLE if none
+
   // Helper functions
-  bool processEmgSignal(uint16_t& emgValue);
+  bool processEmgSignal(EmgFeatureVector& emgFeatures);
+  bool pollButtons(uint8_t& gestureId);
+  bool selectGesture(const EmgFeatureVector& emgFeatures, uint8_t& gestureId);
   bool executeGesture(uint8_t gestureId);
   bool sendGestureData(uint8_t gestureId, uint16_t emgValue);
+  bool sendLatencyReport();
+  bool sendAnswer(uint8_t id, uint8_t status);
+  bool sendFrame(uint8_t id, const uint8_t* payload, uint8_t length);
+
+  static uint8_t onSetThreshold(void* context, const uint8_t* payload, uint8_t length);
+  static uint8_t onTriggerGesture(void* context, const uint8_t* payload, uint8_t length);
+  static uint8_t onStream(void* context, const uint8_t* payload, uint8_t length);
+  static uint8_t onQueryStats(void* context, const uint8_t* payload, uint8_t length);
 };
 
+// Arena bytes one BionicArm takes with its modules and their drivers (one port per matrix side)
+static constexpr size_t BIONIC_ARM_ARENA_BYTES =
+  StaticArena::footprint<BionicArm, EmgSensor, PlatformAdc, MotorBank, PlatformPwmGroup,
+                         ButtonMatrix, PlatformGpioPort, PlatformGpioPort, Communication,
+                         PlatformLink>();
+
 #endif // BIONIC_ARM_H 
\ No newline at end of file
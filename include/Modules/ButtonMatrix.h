@@ -8,6 +8,15 @@
  * @brief   : Button Matrix class header file
  * 
  **************************************************************************************************
+ *
+ * Rows and columns are GPIO ports, so a scan costs one port write and one port read per row
+ * and returns every held key as a bitmap. Between scans every row is driven LOW, so any key press pulls its column down and raises a
+ * column change interrupt. The handler only records the time of the edge. update() then runs a
+ * debounce state machine: once the columns have been quiet for BUTTON_DEBOUNCE_US it scans the
+ * matrix a single time and queues a press or release event for every key that changed. While
+ * nothing changes, update() costs one atomic exchange. A key pressed on a column that another
+ * held key already pulls low makes no edge, it is seen at the next change of that column.
+ *
  */
 
 #ifndef BUTTON_MATRIX_H 
@@ -16,8 +25,27 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
-#include "IGpio.h"
+#include "IGpioPort.h"
 #include "GpioFactory.h"
+#include "SpscRing.h"
+#include <atomic>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define BUTTON_DEBOUNCE_US 5000     // Quiet time after the last edge before the matrix is read
+#define BUTTON_EVENT_QUEUE 16       // Events kept until getEvent(), power of two
+#define BUTTON_MAX_KEYS 32          // rows x columns, one bit per key
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct ButtonEvent {
+  uint32_t timeUs;    // First edge of the change, micros()
+  uint8_t row;
+  uint8_t col;
+  bool pressed;       // false for a release
+};
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
@@ -29,13 +57,33 @@ public:
                const uint8_t* colPins, uint8_t colCount);
   ~ButtonMatrix();
   bool setup();
-  bool read(uint8_t& row, uint8_t& col);
+  bool update();
+  bool getEvent(ButtonEvent& event);
+  bool read(uint32_t& keys);
+  uint32_t getScanCount() const;
     
 private:
-  IGpio** rowGpios;
-  IGpio** colGpios;
+  IGpioPort* rows;
+  IGpioPort* cols;
   uint8_t rowCount;
   uint8_t colCount;
+  uint32_t allRows;
+  uint32_t allCols;
+
+  // Written by the column interrupt
+  std::atomic<bool> changed;
+  std::atomic<uint32_t> lastEdgeUs;
+  std::atomic<bool> scanning;
+
+  // Debounce state
+  bool debouncing;
+  uint32_t firstEdgeUs;
+  uint32_t stableKeys;        // Bit row * colCount + col set while the key is held
+  uint32_t scanCount;
+  SpscRing<ButtonEvent, BUTTON_EVENT_QUEUE> events;
+
+  uint32_t scan();
+  static void onColumnChange(void* context);
 };
 
-#endif // BUTTON_MATRIX_H 
\ No newline at end of file
+#endif // BUTTON_MATRIX_H 
@@ -15,6 +15,15 @@
  * 
  **************************************************************************************************
  *
+ * Communication is itself an ITransport, so callers gather a frame from its parts with
+ * writeSpans(), straight into the queue. writeData() never waits on the link. Frames are
+ * appended whole to the fill buffer of a
+ * double buffer while update() hands the drain buffer to the link, only as many bytes as it
+ * accepts without blocking (availableForWrite(), backed by the UART driver buffer and its
+ * interrupt on target, by a simulated FIFO on the host). When the drain buffer is empty the
+ * buffers swap. A frame that does not fit the fill buffer is dropped, or the frames waiting
+ * there are, depending on the TxDropPolicy. Call the writes and update() from one context.
+ *
  */
 
 #ifndef COMMUNICATION_H 
@@ -26,26 +35,64 @@
 #include "ISerial.h"
 #include "IWifi.h"
 #include "SerialFactory.h"
-// #include "Factories/WifiFactory.h"
+#include "WifiFactory.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define COMM_TX_BUFFER_BYTES 512  // Per buffer, also the largest frame that can be queued
+#ifndef COMM_TX_DROP_POLICY
+#define COMM_TX_DROP_POLICY TX_DROP_OLDEST
+#endif
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+enum TxDropPolicy : uint8_t {
+  TX_DROP_NEWEST,           // Reject the frame being queued
+  TX_DROP_OLDEST            // Discard the frames waiting in the fill buffer
+};
+
+struct TxQueueStats {
+  uint32_t framesQueued;
+  uint32_t framesDropped;
+  uint32_t bytesSent;
+  size_t bytesPending;      // Queued, not yet accepted by the link
+};
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class Communication {
+class Communication : public ITransport {
  
 public:
   Communication();
   ~Communication();
-  bool setup();
-  bool writeData(const uint8_t* data, size_t length, size_t& bytesWritten);
-  bool readData(uint8_t* buffer, size_t length, size_t& bytesRead);
+  bool setup() override;
+  bool writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) override;
+  bool readData(uint8_t* buffer, size_t length, size_t& bytesRead) override;
+  bool availableForWrite(size_t& space) override;
+  bool update() override;
+  void setDropPolicy(TxDropPolicy policy);
+  void getTxStats(TxQueueStats& stats) const;
     
 private:
-  #ifdef WIFI_COMMUNICATION
-    IWifi* comm;
-  #else
-    ISerial* comm;
-  #endif
+  struct TxBuffer {
+    uint8_t data[COMM_TX_BUFFER_BYTES];
+    size_t length;
+    size_t sent;
+    uint16_t frames;
+  };
+
+  ITransport* comm;
+
+  // Transmit double buffer, txBuffers[fillIndex] receives frames, the other one is drained
+  TxBuffer txBuffers[2];
+  uint8_t fillIndex;
+  TxDropPolicy dropPolicy;
+  uint32_t framesQueued;
+  uint32_t framesDropped;
+  uint32_t bytesSent;
 };
 
 #endif // COMMUNICATION_H 
\ No newline at end of file
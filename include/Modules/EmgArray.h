@@ -0,0 +1,57 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgArray.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Multi-channel EMG electrode array header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Several electrodes sampled by one ADC scan. Blocks are kept as a structure of arrays: one
+ * contiguous buffer per channel, so the per-channel filter streams through memory and never
+ * strides over the other channels.
+ *
+ */
+
+#ifndef EMG_ARRAY_H
+#define EMG_ARRAY_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IAdcScan.h"
+#include "AdcFactory.h"
+#include "EmgSensor.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class EmgArray {
+
+public:
+  EmgArray(const uint8_t* pins, uint8_t count);
+  ~EmgArray();
+  bool setup();
+  uint8_t getChannelCount() const;
+  bool startAcquisition(uint32_t scanRateHz = EMG_SAMPLE_RATE_HZ);
+  bool stopAcquisition();
+  bool readBlock(uint16_t* const* block, uint32_t* timestampsUs, size_t blockSize);
+  bool filterBlock(const uint16_t* const* raw, int16_t* const* filtered, size_t count);
+
+private:
+  // Private attributes
+  IAdcScan* scan;
+  uint8_t channelCount;
+  size_t blockFill;
+  BiquadChain<EMG_FILTER_SECTIONS, ADC_SCAN_MAX_CHANNELS> filter;
+};
+
+#endif // EMG_ARRAY_H
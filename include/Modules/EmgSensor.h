@@ -25,21 +25,152 @@
 /*-----------------------------------------------------------------------------------------------*/
 #include "IAdc.h"
 #include "AdcFactory.h"
+#include "Biquad.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define EMG_SAMPLE_RATE_HZ 1000   // Rate the filter presets are designed for
+#define EMG_MAINS_HZ 50           // Power line frequency removed by the notch (50 or 60)
+#define EMG_ADC_MIDSCALE 2048     // Resting level of the EMG front end
+#define EMG_FILTER_SECTIONS 3     // 20 Hz high-pass, mains notch, 450 Hz low-pass
+
+// Designed by the compiler, only the Q2.30 integers end up in the image
+static constexpr BiquadCascade<EMG_FILTER_SECTIONS> emgFilterCascade =
+  BiquadDesign::emgPreset(EMG_SAMPLE_RATE_HZ, EMG_MAINS_HZ);
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class EmgSensor {
+/**
+ * Acquisition and filtering of one EMG channel, written once for both driver paths. AdcT is IAdc
+ * for EmgSensor, which gets its driver from AdcFactory, or a final driver class for
+ * StaticEmgSensor, which holds it by value so every call is direct. The derived class owns the
+ * driver.
+ */
+template <typename AdcT>
+class BasicEmgSensor {
+
+public:
+  bool setup();
+  bool read(uint16_t& value);
+  bool startAcquisition(uint32_t sampleRateHz = EMG_SAMPLE_RATE_HZ);
+  bool stopAcquisition();
+  bool readBlock(uint16_t* block, size_t blockSize);
+  bool filterBlock(const uint16_t* raw, int16_t* filtered, size_t count);
+
+protected:
+  explicit BasicEmgSensor(AdcT* adc);
+  BasicEmgSensor(const BasicEmgSensor&) = delete;
+  BasicEmgSensor& operator=(const BasicEmgSensor&) = delete;
+
+  AdcT* adc;
+  size_t blockFill;
+  BiquadChain<EMG_FILTER_SECTIONS, 1> filter;
+};
+
+class EmgSensor : public BasicEmgSensor<IAdc> {
  
 public:
   EmgSensor(uint8_t pin);
   ~EmgSensor();
-  bool setup();
-  bool read(uint16_t& value);
-    
-private:
-  // Private attributes
-  IAdc* adc;  
 };
 
+/*-----------------------------------------------------------------------------------------------*/
+/* Template methods                                                                              */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor
+  * @param      adc Driver owned by the derived class, nullptr if none could be created
+  * @return     Nothing
+  ********************************************************************************************** */
+template <typename AdcT>
+BasicEmgSensor<AdcT>::BasicEmgSensor(AdcT* adc) : filter(emgFilterCascade) {
+  this->adc = adc;
+  this->blockFill = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Setup EMG sensor
+  * @return     true if setup successful
+  ********************************************************************************************** */
+template <typename AdcT>
+bool BasicEmgSensor<AdcT>::setup() {
+  return (this->adc != nullptr && this->adc->setup());
+}
+
+/**************************************************************************************************
+  * @brief      Read EMG value
+  * @return     true if read successful
+  ********************************************************************************************** */
+template <typename AdcT>
+bool BasicEmgSensor<AdcT>::read(uint16_t& value) {
+  return (this->adc != nullptr && this->adc->read(value));
+}
+
+/**************************************************************************************************
+  * @brief      Start continuous acquisition
+  * @param      sampleRateHz Sampling frequency, filterBlock() expects EMG_SAMPLE_RATE_HZ
+  * @return     true if acquisition started
+  ********************************************************************************************** */
+template <typename AdcT>
+bool BasicEmgSensor<AdcT>::startAcquisition(uint32_t sampleRateHz) {
+  this->blockFill = 0;
+  this->filter.reset();
+  return (this->adc != nullptr && this->adc->startContinuous(sampleRateHz));
+}
+
+/**************************************************************************************************
+  * @brief      Stop continuous acquisition
+  * @return     true if acquisition stopped
+  ********************************************************************************************** */
+template <typename AdcT>
+bool BasicEmgSensor<AdcT>::stopAcquisition() {
+  this->blockFill = 0;
+  return (this->adc != nullptr && this->adc->stopContinuous());
+}
+
+/**************************************************************************************************
+  * @brief      Collect a whole block of samples without blocking
+  * @param      block Block buffer, must be the same buffer until the block is complete
+  * @param      blockSize Number of samples per block
+  * @return     true once the block is full, false while it is still being filled
+  ********************************************************************************************** */
+template <typename AdcT>
+bool BasicEmgSensor<AdcT>::readBlock(uint16_t* block, size_t blockSize) {
+  if (this->adc == nullptr || block == nullptr || this->blockFill >= blockSize) {
+    return false;
+  }
+  size_t samplesRead = 0;
+  if (this->adc->readBlock(block + this->blockFill, blockSize - this->blockFill, samplesRead)) {
+    this->blockFill += samplesRead;
+  }
+  if (this->blockFill < blockSize) {
+    return false;
+  }
+  this->blockFill = 0;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Remove DC offset, mains hum and out-of-band noise from a block of raw samples
+  * @param      raw Raw ADC samples
+  * @param      filtered Filtered samples centred on zero, may not alias raw
+  * @param      count Number of samples
+  * @return     true if the block was filtered
+  * @details    Blocks must be passed in acquisition order, the filter keeps its state between
+  *             calls. Integer only, about 15 multiply-accumulates per sample.
+  ********************************************************************************************** */
+template <typename AdcT>
+bool BasicEmgSensor<AdcT>::filterBlock(const uint16_t* raw, int16_t* filtered, size_t count) {
+  if (raw == nullptr || filtered == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    filtered[i] = (int16_t)(raw[i] - EMG_ADC_MIDSCALE);
+  }
+  this->filter.process(0, filtered, filtered, count);
+  return true;
+}
+
 #endif // EMG_SENSOR_H 
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : MotorBank.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Motor Bank class header file
+ * 
+ **************************************************************************************************
+ */
+
+#ifndef MOTOR_BANK_H 
+#define MOTOR_BANK_H 
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IPwmGroup.h"
+#include "PwmFactory.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define MOTOR_BANK_MAX_MOTORS 8
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+// All H-bridge motors of the hand on one PWM group: speeds are staged per motor and reach
+// the outputs together on commit()
+class MotorBank {
+ 
+public:
+  MotorBank(const uint8_t* motorPins,   // Forward and backward pin of each motor
+            uint8_t motorCount);
+  ~MotorBank();
+  bool setup();
+  bool set(uint8_t motor, int16_t speed);
+  bool commit();
+    
+private:
+  IPwmGroup* pwmGroup;
+  uint8_t motorCount;
+};
+
+#endif // MOTOR_BANK_H 
@@ -22,19 +22,67 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class MotorDriver {
- 
+/**
+ * H-bridge control of one motor from two PWM outputs, written once for both driver paths. PwmT
+ * is IPwm for MotorDriver, which gets its outputs from PwmFactory, or a final driver class for
+ * StaticMotorDriver, which holds them by value. The derived class owns the outputs.
+ */
+template <typename PwmT>
+class BasicMotorDriver {
+
 public:
-  MotorDriver(uint8_t forwardPin, uint8_t backwardPin);
-  ~MotorDriver();
   bool setup();
   bool forward(uint8_t speed);
   bool backward(uint8_t speed);
   bool stop();
-    
-private:
-  IPwm* forwardPwm;
-  IPwm* backwardPwm;
+
+protected:
+  BasicMotorDriver(PwmT* forwardPwm, PwmT* backwardPwm);
+  BasicMotorDriver(const BasicMotorDriver&) = delete;
+  BasicMotorDriver& operator=(const BasicMotorDriver&) = delete;
+
+  PwmT* forwardPwm;
+  PwmT* backwardPwm;
 };
 
+class MotorDriver : public BasicMotorDriver<IPwm> {
+ 
+public:
+  MotorDriver(uint8_t forwardPin, uint8_t backwardPin);
+  ~MotorDriver();
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Template methods                                                                              */
+/*-----------------------------------------------------------------------------------------------*/
+template <typename PwmT>
+BasicMotorDriver<PwmT>::BasicMotorDriver(PwmT* forwardPwm, PwmT* backwardPwm) {
+  this->forwardPwm = forwardPwm;
+  this->backwardPwm = backwardPwm;
+}
+
+template <typename PwmT>
+bool BasicMotorDriver<PwmT>::setup() {
+  return (this->forwardPwm != nullptr && this->forwardPwm->setup() &&
+          this->backwardPwm != nullptr && this->backwardPwm->setup());
+}
+
+template <typename PwmT>
+bool BasicMotorDriver<PwmT>::forward(uint8_t speed) {
+  return (this->forwardPwm != nullptr && this->backwardPwm != nullptr &&
+          this->forwardPwm->write(speed) && this->backwardPwm->write(0));
+}
+
+template <typename PwmT>
+bool BasicMotorDriver<PwmT>::backward(uint8_t speed) {
+  return (this->forwardPwm != nullptr && this->backwardPwm != nullptr &&
+          this->forwardPwm->write(0) && this->backwardPwm->write(speed));
+}
+
+template <typename PwmT>
+bool BasicMotorDriver<PwmT>::stop() {
+  return (this->forwardPwm != nullptr && this->backwardPwm != nullptr &&
+          this->forwardPwm->write(0) && this->backwardPwm->write(0));
+}
+
 #endif // MOTOR_DRIVER_H 
\ No newline at end of file
@@ -0,0 +1,51 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : StaticEmgSensor.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : EMG Sensor with a compile-time ADC driver
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * EmgSensor with the ADC driver as a template parameter held by value instead of an IAdc
+ * pointer from AdcFactory. The code is BasicEmgSensor's, only the ownership of the driver
+ * differs. AdcT needs the IAdc methods, it does not have to derive from IAdc.
+ * PlatformEmgSensor uses the driver of the platform being built.
+ *
+ */
+
+#ifndef STATIC_EMG_SENSOR_H
+#define STATIC_EMG_SENSOR_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "EmgSensor.h"
+#include "StaticHal.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+template <typename AdcT>
+class StaticEmgSensor : public BasicEmgSensor<AdcT> {
+
+public:
+  // The base only keeps the address of the driver, which is constructed right after it
+  explicit StaticEmgSensor(uint8_t pin) : BasicEmgSensor<AdcT>(&driver), driver(pin) {
+  }
+
+private:
+  AdcT driver;
+};
+
+typedef StaticEmgSensor<PlatformAdc> PlatformEmgSensor;
+
+#endif // STATIC_EMG_SENSOR_H
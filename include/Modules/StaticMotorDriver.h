@@ -0,0 +1,53 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : StaticMotorDriver.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Motor Driver with a compile-time PWM driver
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * MotorDriver with both PWM outputs held by value. The code is BasicMotorDriver's, only the
+ * ownership of the outputs differs. PwmT needs setup() and write(uint8_t) like IPwm.
+ * PlatformMotorDriver uses the driver of the platform being built.
+ *
+ */
+
+#ifndef STATIC_MOTOR_DRIVER_H
+#define STATIC_MOTOR_DRIVER_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "MotorDriver.h"
+#include "StaticHal.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+template <typename PwmT>
+class StaticMotorDriver : public BasicMotorDriver<PwmT> {
+
+public:
+  // The base only keeps the addresses of the outputs, which are constructed right after it
+  StaticMotorDriver(uint8_t forwardPin, uint8_t backwardPin)
+    : BasicMotorDriver<PwmT>(&forwardOutput, &backwardOutput),
+      forwardOutput(forwardPin), backwardOutput(backwardPin) {
+  }
+
+private:
+  PwmT forwardOutput;
+  PwmT backwardOutput;
+};
+
+typedef StaticMotorDriver<PlatformPwm> PlatformMotorDriver;
+
+#endif // STATIC_MOTOR_DRIVER_H
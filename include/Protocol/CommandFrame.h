@@ -0,0 +1,128 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : CommandFrame.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Command frame encoder and incremental parser header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Commands sent to the arm and its answers share one wire format:
+ *
+ *   [sync:1 = 0xA5][id:1][length:1][payload:length][crc8:1]
+ *
+ * length is at most COMMAND_MAX_PAYLOAD, multi-byte payload fields are little endian and the
+ * CRC-8 (polynomial 0x07, initial value 0) covers id, length and payload. Answers set bit 7 of
+ * the id of the command they answer. Frames a device sends on its own, telemetry, use ids
+ * COMMAND_TELEMETRY to 0x7F, so a host can tell them from answers and never resyncs on a data
+ * byte equal to the sync byte.
+ *
+ * CommandParser is a byte-at-a-time state machine: each push() costs a few operations and the
+ * payload is kept in a COMMAND_MAX_PAYLOAD byte array, so nothing is buffered up to a line
+ * ending. A frame with a valid CRC is dispatched through a static table of handlers. After a
+ * corrupted frame the parser hunts for the next sync byte.
+ *
+ * This file only depends on the C standard library so host tools can build it unchanged.
+ *
+ */
+
+#ifndef COMMAND_FRAME_H
+#define COMMAND_FRAME_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define COMMAND_SYNC          0xA5
+#define COMMAND_MAX_PAYLOAD   8
+#define COMMAND_ANSWER        0x80    // Set in the id of an answer
+#define COMMAND_TELEMETRY     0x40    // First telemetry id, up to 0x7F
+
+// Size of a frame on the wire
+#define COMMAND_HEADER_BYTES  3       // Sync, id and length
+#define COMMAND_FRAME_BYTES(length) ((length) + COMMAND_HEADER_BYTES + 1)
+
+// Answer status, payload of the answer to every command
+#define COMMAND_OK            0x00
+#define COMMAND_UNKNOWN       0x01    // No handler for the id
+#define COMMAND_BAD_LENGTH    0x02    // Payload length does not match the handler
+#define COMMAND_REJECTED      0x03    // Handler refused the arguments
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+// Returns a COMMAND_* status, runs in the context calling CommandParser::push()
+typedef uint8_t (*CommandCallback)(void* context, const uint8_t* payload, uint8_t length);
+
+// Header and trailer of a frame whose payload stays in the caller's buffer, for gather writes
+struct CommandFrameParts {
+  uint8_t header[COMMAND_HEADER_BYTES];
+  uint8_t crc;
+};
+
+struct CommandHandler {
+  uint8_t id;
+  uint8_t length;             // Expected payload length
+  CommandCallback callback;
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class CommandFrame {
+
+public:
+  static bool encode(uint8_t id, const uint8_t* payload, uint8_t length,
+                     uint8_t* out, size_t outSize, size_t& outLength);
+  static bool frame(uint8_t id, const uint8_t* payload, uint8_t length,
+                    CommandFrameParts& parts);
+  static uint8_t crc8(uint8_t byte, uint8_t crc);
+};
+
+class CommandParser {
+
+public:
+  CommandParser(const CommandHandler* handlers, uint8_t handlerCount, void* context);
+
+  // true once a frame is complete and dispatched, id and status describe it
+  bool push(uint8_t byte, uint8_t& id, uint8_t& status);
+  uint32_t errors() const;
+
+private:
+  enum State : uint8_t {
+    STATE_SYNC,
+    STATE_ID,
+    STATE_LENGTH,
+    STATE_PAYLOAD,
+    STATE_CRC
+  };
+
+  const CommandHandler* handlers;
+  uint8_t handlerCount;
+  void* context;
+
+  State state;
+  uint8_t id;
+  uint8_t length;
+  uint8_t received;
+  uint8_t crc;
+  uint8_t payload[COMMAND_MAX_PAYLOAD];
+  uint32_t errorCount;
+
+  uint8_t dispatch();
+};
+
+#endif // COMMAND_FRAME_H
@@ -0,0 +1,68 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgCodec.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Lossless EMG sample codec header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Lossless compression of 12-bit EMG samples, payload of EMG_FRAME_TYPE_RICE frames. Samples
+ * are interleaved, channels per scan; each channel is coded on its own, MSB first:
+ *
+ *   [first sample:12]
+ *   then per block of up to EMG_CODEC_BLOCK samples: [order:2][k:4][residual codes]
+ *
+ * The predictor order is chosen per block: 0 predicts mid-scale, 1 the previous sample, 2 the
+ * line through the two previous samples. Residuals are zigzag mapped and Rice coded with the
+ * parameter k that suits the mean of the block: quotient in unary (zeros ended by a one),
+ * then k bits. A quotient of EMG_CODEC_ESCAPE or more is sent as EMG_CODEC_ESCAPE zeros and
+ * the residual on EMG_CODEC_RAW_BITS, so every sample costs one bounded write whatever the
+ * signal. The stream is padded with zeros to a whole byte. Channel state (the two previous
+ * samples) starts again in every frame, so a lost frame never corrupts the next ones.
+ *
+ * This file only depends on the C standard library so host tools can build it unchanged.
+ *
+ */
+
+#ifndef EMG_CODEC_H
+#define EMG_CODEC_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define EMG_CODEC_BLOCK       16      // Samples sharing one predictor order and Rice parameter
+#define EMG_CODEC_MIDSCALE    2048    // Prediction of order 0
+#define EMG_CODEC_MAX_K       13
+#define EMG_CODEC_ESCAPE      16      // Quotients from here on are sent raw
+#define EMG_CODEC_RAW_BITS    15      // Enough for any zigzag mapped order 2 residual
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class EmgCodec {
+
+public:
+  // false if the stream would not fit outSize, the caller then sends the samples packed
+  static bool encode(const uint16_t* samples, size_t count, uint8_t channels,
+                     uint8_t* out, size_t outSize, size_t& outLength);
+  // false unless the stream holds exactly count samples and nothing else
+  static bool decode(const uint8_t* in, size_t length, uint8_t channels,
+                     uint16_t* samples, size_t count);
+};
+
+#endif // EMG_CODEC_H
@@ -0,0 +1,127 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgFrame.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Binary EMG streaming frame encoder/decoder header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Wire format (version 1), all multi-byte fields little endian:
+ *
+ *   [version:1][type:1][label:1][channels:1][sequence:2][timestampUs:4][sampleCount:2]
+ *   [packed samples: 3 bytes per pair of 12-bit samples, 2 bytes for an odd last sample]
+ *   [crc16:2]  CRC-16/CCITT-FALSE over everything above
+ *
+ * Frames of type EMG_FRAME_TYPE_RICE carry the samples compressed by EmgCodec instead of
+ * packed, with the same header. The encoder falls back to a packed EMG_FRAME_TYPE_SAMPLES frame
+ * whenever compression would not save anything, so a frame is never larger than a packed one.
+ *
+ * The whole frame is COBS encoded and terminated by a single 0x00 byte, so a receiver can
+ * resynchronise on the next delimiter after any corruption or dropped byte.
+ *
+ * This file only depends on the C standard library so host tools can build it unchanged.
+ *
+ */
+
+#ifndef EMG_FRAME_H
+#define EMG_FRAME_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define EMG_FRAME_VERSION         1
+#define EMG_FRAME_TYPE_SAMPLES    0x01
+#define EMG_FRAME_TYPE_RICE       0x02    // Samples compressed by EmgCodec
+#define EMG_FRAME_DELIMITER       0x00
+#define EMG_FRAME_HEADER_BYTES    12
+#define EMG_FRAME_CRC_BYTES       2
+#define EMG_FRAME_MAX_SAMPLES     512
+
+// Frame types decode() turns into samples
+#define EMG_FRAME_HAS_SAMPLES(type) \
+  ((type) == EMG_FRAME_TYPE_SAMPLES || (type) == EMG_FRAME_TYPE_RICE)
+
+// Size of the packed payload for a number of 12-bit samples
+#define EMG_FRAME_PAYLOAD_BYTES(samples) ((((samples) * 3) + 1) / 2)
+
+// Size of a frame before COBS encoding
+#define EMG_FRAME_RAW_BYTES(samples) \
+  (EMG_FRAME_HEADER_BYTES + EMG_FRAME_PAYLOAD_BYTES(samples) + EMG_FRAME_CRC_BYTES)
+
+// Worst case size on the wire: COBS adds one byte per 254 bytes, plus the delimiter
+#define EMG_FRAME_ENCODED_BYTES(samples) \
+  (EMG_FRAME_RAW_BYTES(samples) + EMG_FRAME_RAW_BYTES(samples) / 254 + 2)
+
+#define EMG_FRAME_MAX_RAW_BYTES      EMG_FRAME_RAW_BYTES(EMG_FRAME_MAX_SAMPLES)
+#define EMG_FRAME_MAX_ENCODED_BYTES  EMG_FRAME_ENCODED_BYTES(EMG_FRAME_MAX_SAMPLES)
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct EmgFrameHeader {
+  uint8_t version;
+  uint8_t type;
+  uint8_t label;
+  uint8_t channels;
+  uint16_t sequence;
+  uint32_t timestampUs;
+  uint16_t sampleCount;
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class EmgFrame {
+
+public:
+  static bool encode(const EmgFrameHeader& header, const uint16_t* samples,
+                     uint8_t* out, size_t outSize, size_t& outLength);
+  static bool decode(const uint8_t* frame, size_t length,
+                     EmgFrameHeader& header, uint16_t* samples, size_t maxSamples);
+
+  static size_t packSamples(const uint16_t* samples, size_t count, uint8_t* out);
+  static void unpackSamples(const uint8_t* packed, size_t count, uint16_t* samples);
+  static uint16_t crc16(const uint8_t* data, size_t length, uint16_t crc = 0xFFFF);
+  static size_t cobsEncode(const uint8_t* in, size_t length, uint8_t* out);
+  static size_t cobsEncodeInPlace(uint8_t* buffer, size_t length);
+  static size_t cobsDecode(const uint8_t* in, size_t length, uint8_t* out);
+};
+
+/**
+ * Byte-at-a-time frame delimiter. Feed every received byte to push(); when it returns true
+ * frame()/length() hold one complete COBS encoded frame (without delimiter) ready for
+ * EmgFrame::decode(). Oversized frames are discarded up to the next delimiter.
+ */
+class EmgFrameReceiver {
+
+public:
+  EmgFrameReceiver();
+  bool push(uint8_t byte);
+  const uint8_t* frame() const;
+  size_t length() const;
+  uint32_t overflows() const;
+
+private:
+  uint8_t buffer[EMG_FRAME_MAX_ENCODED_BYTES];
+  size_t fill;
+  size_t frameLength;
+  bool discarding;
+  uint32_t overflowCount;
+};
+
+#endif // EMG_FRAME_H
@@ -0,0 +1,73 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : DatagramBatch.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Coalesces frames into datagrams up to the MTU with a flush deadline
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Shared by the IWifi backends. Every datagram costs a radio transmission and its headers, so
+ * small telemetry frames are packed together and a datagram only leaves when the next frame
+ * does not fit or when its first frame has waited the flush deadline. Frames are never split,
+ * so a lost datagram loses whole frames only. The caller owns the socket and the clock.
+ *
+ */
+
+#ifndef DATAGRAM_BATCH_H
+#define DATAGRAM_BATCH_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "ITransport.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define DATAGRAM_BATCH_BYTES 1472   // 1500-byte MTU minus the IPv4 and UDP headers
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct DatagramStats {
+  uint32_t framesSent;
+  uint32_t datagramsSent;
+  uint32_t framesDropped;   // In datagrams the network stack refused
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class DatagramBatch {
+
+public:
+  DatagramBatch(uint32_t deadlineUs);
+  void setDeadline(uint32_t deadlineUs);
+
+  // false if the frame does not fit the current datagram: send it, then append again
+  bool append(const TransportSpan* spans, size_t count, uint32_t nowUs);
+  bool due(uint32_t nowUs) const;
+  const uint8_t* data() const;
+  size_t length() const;
+  void sent(bool success);
+  void getStats(DatagramStats& stats) const;
+
+private:
+  uint8_t buffer[DATAGRAM_BATCH_BYTES];
+  size_t fill;
+  uint16_t frames;
+  uint32_t firstFrameUs;
+  uint32_t deadlineUs;
+  DatagramStats stats;
+};
+
+#endif // DATAGRAM_BATCH_H
@@ -0,0 +1,123 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : LatencyTrace.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Per-stage latency histograms based on the CPU cycle counter
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * begin()/end() read a free-running tick counter: CCOUNT on ESP32, DWT->CYCCNT on STM32 and
+ * steady_clock nanoseconds on the host. The duration goes into a log-scale histogram with four
+ * buckets per octave (at most 19 % quantisation error), so recording is a handful of
+ * instructions and memory use is fixed. Percentiles are only computed when a report is asked.
+ * The cost of an empty begin()/end() pair is measured at construction and subtracted.
+ *
+ */
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#if defined(ARDUINO_ARCH_ESP32)
+#include <Arduino.h>
+#include <hal/cpu_hal.h>
+#elif defined(ARDUINO_ARCH_STM32)
+#include <Arduino.h>
+#elif defined(HOST_NATIVE)
+#include <chrono>
+#endif
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define LATENCY_TRACE_MAX_STAGES  8
+#define LATENCY_TRACE_SUB_BITS    2                                      // 4 buckets per octave
+#define LATENCY_TRACE_OCTAVES     28                                     // Up to 2^28 ticks
+#define LATENCY_TRACE_BUCKETS     (LATENCY_TRACE_OCTAVES << LATENCY_TRACE_SUB_BITS)
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct LatencyReport {
+  const char* name;
+  uint32_t count;
+  uint32_t p50Ns;   // Upper bound of the bucket holding the percentile
+  uint32_t p99Ns;
+  uint32_t maxNs;   // Exact
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class LatencyTrace {
+
+public:
+  LatencyTrace(const char* const* stageNames, uint8_t stageCount);
+  void reset();
+  uint8_t getStageCount() const;
+  uint32_t getOverheadNs() const;
+  bool getReport(uint8_t stage, LatencyReport& report) const;
+  size_t formatReport(uint8_t stage, char* buffer, size_t size) const;
+
+  inline void begin(uint8_t stage) {
+    this->starts[stage] = now();
+  }
+
+  inline void end(uint8_t stage) {
+    record(stage, now() - this->starts[stage]);
+  }
+
+  // end() for a start taken with now() elsewhere, such as the producer of a queued item. On
+  // the ESP32 each core has its own cycle counter, so both ends must run on the same core.
+  inline void endFrom(uint8_t stage, uint32_t startTicks) {
+    record(stage, now() - startTicks);
+  }
+
+  static inline uint32_t now() {
+  #if defined(ARDUINO_ARCH_ESP32)
+    return cpu_hal_get_cycle_count();
+  #elif defined(ARDUINO_ARCH_STM32)
+    return DWT->CYCCNT;
+  #elif defined(HOST_NATIVE)
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  #else
+    return 0;
+  #endif
+  }
+
+  static uint32_t ticksToNs(uint32_t ticks);
+
+private:
+  struct Stage {
+    const char* name;
+    uint32_t count;
+    uint32_t maxTicks;
+    uint32_t buckets[LATENCY_TRACE_BUCKETS];
+  };
+
+  Stage stages[LATENCY_TRACE_MAX_STAGES];
+  uint32_t starts[LATENCY_TRACE_MAX_STAGES];
+  uint8_t stageCount;
+  uint32_t overheadTicks;
+
+  void record(uint8_t stage, uint32_t ticks);
+  uint32_t percentile(const Stage& stage, uint32_t perMille) const;
+  static uint8_t bucketOf(uint32_t ticks);
+  static uint32_t bucketUpperBound(uint8_t bucket);
+};
+
+#endif // LATENCY_TRACE_H
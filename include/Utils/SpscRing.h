@@ -0,0 +1,166 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : SpscRing.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Lock-free single-producer single-consumer ring buffer
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * One context (ISR, task or thread) pushes, one other context pops. Indices are free-running
+ * and only written by their owner, so no lock or critical section is needed. Each side keeps a
+ * cached copy of the other side's index and only reloads it when the ring looks full or empty.
+ *
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#ifdef HOST_NATIVE
+#define SPSC_RING_ALIGN 64  // Keep producer and consumer indices on separate cache lines
+#else
+#define SPSC_RING_ALIGN 4
+#endif
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "SpscRing capacity must be a power of two");
+
+public:
+  SpscRing() : head(0), cachedTail(0), overrunCount(0), tail(0), cachedHead(0) {
+  }
+
+  /* Producer side ------------------------------------------------------------------------------*/
+  bool push(const T& item) {
+    size_t h = this->head.load(std::memory_order_relaxed);
+    if (h - this->cachedTail == Capacity) {
+      this->cachedTail = this->tail.load(std::memory_order_acquire);
+      if (h - this->cachedTail == Capacity) {
+        this->overrunCount.store(this->overrunCount.load(std::memory_order_relaxed) + 1,
+                                 std::memory_order_relaxed);
+        return false;
+      }
+    }
+    this->buffer[h & (Capacity - 1)] = item;
+    this->head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Pushes as many items as fit, the remaining ones are counted as overruns
+  size_t pushBlock(const T* items, size_t count) {
+    size_t h = this->head.load(std::memory_order_relaxed);
+    size_t space = Capacity - (h - this->cachedTail);
+    if (space < count) {
+      this->cachedTail = this->tail.load(std::memory_order_acquire);
+      space = Capacity - (h - this->cachedTail);
+    }
+    size_t pushed = count < space ? count : space;
+    for (size_t i = 0; i < pushed; i++) {
+      this->buffer[(h + i) & (Capacity - 1)] = items[i];
+    }
+    this->head.store(h + pushed, std::memory_order_release);
+    if (pushed < count) {
+      this->overrunCount.store(this->overrunCount.load(std::memory_order_relaxed) +
+                               (uint32_t)(count - pushed), std::memory_order_relaxed);
+    }
+    return pushed;
+  }
+
+  // Pushes all items or none of them, so a record spanning several items is never split
+  bool pushAll(const T* items, size_t count) {
+    size_t h = this->head.load(std::memory_order_relaxed);
+    if (Capacity - (h - this->cachedTail) < count) {
+      this->cachedTail = this->tail.load(std::memory_order_acquire);
+      if (Capacity - (h - this->cachedTail) < count) {
+        this->overrunCount.store(this->overrunCount.load(std::memory_order_relaxed) +
+                                 (uint32_t)count, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    return pushBlock(items, count) == count;
+  }
+
+  /* Consumer side ------------------------------------------------------------------------------*/
+  bool pop(T& item) {
+    size_t t = this->tail.load(std::memory_order_relaxed);
+    if (t == this->cachedHead) {
+      this->cachedHead = this->head.load(std::memory_order_acquire);
+      if (t == this->cachedHead) {
+        return false;
+      }
+    }
+    item = this->buffer[t & (Capacity - 1)];
+    this->tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t popBlock(T* items, size_t maxCount) {
+    size_t t = this->tail.load(std::memory_order_relaxed);
+    size_t available = this->cachedHead - t;
+    if (available < maxCount) {
+      this->cachedHead = this->head.load(std::memory_order_acquire);
+      available = this->cachedHead - t;
+    }
+    size_t popped = maxCount < available ? maxCount : available;
+    for (size_t i = 0; i < popped; i++) {
+      items[i] = this->buffer[(t + i) & (Capacity - 1)];
+    }
+    this->tail.store(t + popped, std::memory_order_release);
+    return popped;
+  }
+
+  /* Either side --------------------------------------------------------------------------------*/
+  size_t size() const {
+    size_t t = this->tail.load(std::memory_order_acquire);
+    return this->head.load(std::memory_order_acquire) - t;
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  static constexpr size_t capacity() {
+    return Capacity;
+  }
+
+  // Items rejected by the producer because the ring was full
+  uint32_t overruns() const {
+    return this->overrunCount.load(std::memory_order_relaxed);
+  }
+
+private:
+  // Producer owned
+  alignas(SPSC_RING_ALIGN) std::atomic<size_t> head;
+  size_t cachedTail;
+  std::atomic<uint32_t> overrunCount;
+
+  // Consumer owned
+  alignas(SPSC_RING_ALIGN) std::atomic<size_t> tail;
+  size_t cachedHead;
+
+  alignas(SPSC_RING_ALIGN) T buffer[Capacity];
+};
+
+#endif // SPSC_RING_H
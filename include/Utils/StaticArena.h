@@ -0,0 +1,114 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : StaticArena.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Fixed-size arena the factories and modules construct their objects in
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * One statically allocated block replaces the heap for everything built at boot: the
+ * application singleton, its modules and their drivers. Allocation bumps a pointer and objects
+ * are placement-constructed, so startup takes the same time and leaves the same layout on
+ * every boot and the heap is never fragmented. Memory is never given back (destroy() only runs
+ * the destructor), which suits objects living as long as the arm. The usage is therefore also
+ * the high-water mark.
+ *
+ * Objects are aligned on STATIC_ARENA_ALIGN, or on their own alignment when it is larger (the
+ * SpscRing indices take a cache line each on the host), up to STATIC_ARENA_MAX_ALIGN.
+ *
+ * footprint<Types...>() gives at compile time the bytes a set of objects takes, so every
+ * application checks with a static_assert that it fits STATIC_ARENA_BYTES. At run time a
+ * request that does not fit returns nullptr and is counted.
+ *
+ * Not thread safe: allocate at boot, before any task or thread starts.
+ *
+ */
+
+#ifndef STATIC_ARENA_H
+#define STATIC_ARENA_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <utility>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#ifndef STATIC_ARENA_BYTES
+#define STATIC_ARENA_BYTES 16384        // Override with -DSTATIC_ARENA_BYTES=n
+#endif
+#define STATIC_ARENA_ALIGN alignof(max_align_t)
+#define STATIC_ARENA_MAX_ALIGN 64       // Cache line of the host, SPSC_RING_ALIGN
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class StaticArena {
+
+public:
+  static void* allocate(size_t size, size_t alignment = STATIC_ARENA_ALIGN);
+
+  // Placement-constructs a T in the arena, nullptr when full
+  template <typename T, typename... Args>
+  static T* create(Args&&... args) {
+    static_assert(alignof(T) <= STATIC_ARENA_MAX_ALIGN,
+                  "Type is over-aligned for the arena, raise STATIC_ARENA_MAX_ALIGN");
+    void* memory = allocate(sizeof(T), alignof(T));
+    return memory != nullptr ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+  }
+
+  // Runs the destructor, the memory stays reserved
+  template <typename T>
+  static void destroy(T* object) {
+    if (object != nullptr) {
+      object->~T();
+    }
+  }
+
+  // Every allocation is rounded up to STATIC_ARENA_ALIGN, so sizes simply add up
+  static constexpr size_t roundUp(size_t size) {
+    return (size + STATIC_ARENA_ALIGN - 1) / STATIC_ARENA_ALIGN * STATIC_ARENA_ALIGN;
+  }
+
+  // Bytes one object may take, including the worst case padding in front of an over-aligned one
+  template <typename T>
+  static constexpr size_t slot() {
+    return roundUp(sizeof(T)) +
+           (alignof(T) > STATIC_ARENA_ALIGN ? alignof(T) - STATIC_ARENA_ALIGN : 0);
+  }
+
+  // Arena bytes taken by one object of each type, whatever the allocation order
+  template <typename... Types>
+  static constexpr size_t footprint() {
+    size_t total = 0;
+    for (size_t size : {(size_t)0, slot<Types>()...}) {
+      total += size;
+    }
+    return total;
+  }
+
+  static size_t getHighWaterMark();
+  static size_t getCapacity();
+  static uint32_t getFailures();
+  static size_t formatReport(char* buffer, size_t size);
+
+private:
+  alignas(STATIC_ARENA_MAX_ALIGN) static uint8_t storage[STATIC_ARENA_BYTES];
+  static size_t used;
+  static uint32_t failures;
+};
+
+#endif // STATIC_ARENA_H
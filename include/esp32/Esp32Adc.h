@@ -25,17 +25,31 @@
 /*-----------------------------------------------------------------------------------------------*/
 #include "IAdc.h"
 
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define ESP32_ADC_DMA_MIN_RATE_HZ   20000   // Lowest rate of the ESP32 ADC DMA controller
+#define ESP32_ADC_DMA_FRAME_BYTES   256     // Bytes moved per DMA interrupt
+#define ESP32_ADC_DMA_BUFFER_BYTES  4096    // Driver ring buffer between DMA and readBlock()
+
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class Esp32Adc : public IAdc {
+class Esp32Adc final : public IAdc {
 public:
     Esp32Adc(uint8_t pin);
     bool setup() override;
     bool read(uint16_t& value) override;
+    bool startContinuous(uint32_t sampleRateHz) override;
+    bool stopContinuous() override;
+    bool readBlock(uint16_t* dst, size_t n, size_t& samplesRead) override;
     
 private:
     uint8_t pin;
+    bool continuous;
+    uint16_t decimation;
+    uint16_t decimationCount;
+    uint32_t decimationSum;
 };
 
 #endif // ESP32_ADC_H 
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32AdcScan.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 multi-channel ADC scan header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * ADC1 continuous mode with one pattern table entry per pin: the DMA controller converts the
+ * pins in table order and repeats the table, so every channel is sampled by the hardware at
+ * the same rate with a fixed skew and no CPU involvement.
+ *
+ */
+
+#ifndef ESP32_ADC_SCAN_H
+#define ESP32_ADC_SCAN_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IAdcScan.h"
+#include "Esp32Adc.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Esp32AdcScan : public IAdcScan {
+
+public:
+  Esp32AdcScan(const uint8_t* pins, uint8_t count);
+  bool setup() override;
+  uint8_t channelCount() const override;
+  bool startScan(uint32_t scanRateHz) override;
+  bool stopScan() override;
+  bool readScans(uint16_t* const* channels, uint32_t* timestampsUs, size_t maxScans,
+                 size_t& scansRead) override;
+
+private:
+  uint8_t pins[ADC_SCAN_MAX_CHANNELS];
+  int8_t slotOfChannel[ADC_SCAN_MAX_CHANNELS];  // ADC1 channel -> position in the scan
+  uint8_t count;
+  bool scanning;
+  uint32_t scanRateHz;
+  uint32_t startUs;
+  uint32_t scanIndex;
+
+  // Oversampling: each output scan averages `decimation` hardware scans
+  uint16_t decimation;
+  uint16_t decimationCount[ADC_SCAN_MAX_CHANNELS];
+  uint32_t decimationSum[ADC_SCAN_MAX_CHANNELS];
+  uint8_t completed;                              // Channels done for the current output scan
+  uint16_t pending[ADC_SCAN_MAX_CHANNELS];
+};
+
+#endif // ESP32_ADC_SCAN_H
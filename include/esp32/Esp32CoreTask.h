@@ -0,0 +1,67 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32CoreTask.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 pinned FreeRTOS task header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * A FreeRTOS task created with xTaskCreatePinnedToCore() and paced by xTaskDelayUntil(), so
+ * the period does not drift with the step duration. The Arduino loop task, which runs the App
+ * scheduler, lives on core 1; core 0 otherwise only runs the WiFi stack. Periods are rounded
+ * up to whole RTOS ticks (1 ms) and a period of 0 waits one tick, so the idle task of the core
+ * still runs and its watchdog stays quiet.
+ *
+ */
+
+#ifndef ESP32_CORE_TASK_H
+#define ESP32_CORE_TASK_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "ICoreTask.h"
+#include <atomic>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define ESP32_CORE_TASK_STACK_BYTES 4096
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Esp32CoreTask final : public ICoreTask {
+
+public:
+  Esp32CoreTask(const char* name, uint8_t core, uint8_t priority);
+  ~Esp32CoreTask();
+  bool start(CoreTaskStep step, void* context, uint32_t periodUs) override;
+  bool stop() override;
+  bool getStats(CoreTaskStats& stats) const override;
+
+private:
+  const char* name;
+  uint8_t core;
+  uint8_t priority;
+  CoreTaskStep step;
+  void* context;
+  uint32_t periodUs;
+  void* finished;     // Binary semaphore given when the task leaves its loop
+  std::atomic<bool> running;
+  std::atomic<uint32_t> steps;
+  std::atomic<uint32_t> overruns;
+
+  static void entry(void* argument);
+};
+
+#endif // ESP32_CORE_TASK_H
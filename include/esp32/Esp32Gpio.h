@@ -28,7 +28,7 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class Esp32Gpio : public IGpio {
+class Esp32Gpio final : public IGpio {
  
 public:
   Esp32Gpio(uint8_t pin, uint8_t mode);
@@ -39,6 +39,8 @@ public:
 private:
   uint8_t pin;
   uint8_t mode;
+
+  bool isInput() const;
 };
 
 #endif // ESP32_GPIO_H 
\ No newline at end of file
@@ -0,0 +1,55 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32GpioPort.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 GPIO Port Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Reads GPIO.in (pins 0-31) and GPIO.in1 (pins 32-39) once per read, and drives outputs
+ * through the write-one-to-set and write-one-to-clear registers, so a write never disturbs
+ * pins outside the port and needs no read-modify-write.
+ *
+ */
+
+#ifndef ESP32_GPIO_PORT_H
+#define ESP32_GPIO_PORT_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IGpioPort.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Esp32GpioPort : public IGpioPort {
+
+public:
+  Esp32GpioPort(const uint8_t* pins, uint8_t count, uint8_t mode);
+  bool setup() override;
+  uint8_t pinCount() const override;
+  bool write(uint32_t mask, uint32_t levels) override;
+  bool read(uint32_t& levels) override;
+  bool attachChangeInterrupt(GpioCallback callback, void* context) override;
+  bool detachChangeInterrupt() override;
+
+private:
+  uint8_t pins[GPIO_PORT_MAX_PINS];
+  uint8_t count;
+  uint8_t mode;
+  bool usesHighBank;     // A pin above 31 needs GPIO.in1 / GPIO.out1
+
+  bool isInput() const;
+};
+
+#endif // ESP32_GPIO_PORT_H
@@ -28,7 +28,7 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class Esp32Pwm : public IPwm {
+class Esp32Pwm final : public IPwm {
  
 public:
   Esp32Pwm(uint8_t pin);
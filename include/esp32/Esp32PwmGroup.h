@@ -0,0 +1,58 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32PwmGroup.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 LEDC PWM group header file
+ * 
+ **************************************************************************************************
+ * 
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ * 
+ **************************************************************************************************
+ *
+ * Every pin gets a dedicated LEDC channel. Channels 0-7 use the high speed block and channels
+ * 8-15 the low speed block, each block clocked by its own timer 0 at the same frequency.
+ * commit() loads all duty registers, which the hardware latches at the end of the running PWM
+ * period, so all outputs change within one period of each other.
+ *
+ */
+
+#ifndef ESP32_PWM_GROUP_H 
+#define ESP32_PWM_GROUP_H 
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IPwmGroup.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define ESP32_PWM_GROUP_MAX_CHANNELS 16
+#define ESP32_PWM_GROUP_FREQUENCY_HZ 20000   // Above the audible range of the finger motors
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Esp32PwmGroup : public IPwmGroup {
+ 
+public:
+  Esp32PwmGroup(const uint8_t* pins, uint8_t count);
+  bool setup() override;
+  uint8_t channelCount() const override;
+  bool stage(uint8_t channel, uint8_t dutyCycle) override;
+  bool commit() override;
+    
+private:
+  uint8_t pins[ESP32_PWM_GROUP_MAX_CHANNELS];
+  uint8_t staged[ESP32_PWM_GROUP_MAX_CHANNELS];
+  uint8_t count;
+  uint16_t dirty;    // One bit per channel staged since the last commit
+};
+
+#endif // ESP32_PWM_GROUP_H 
@@ -33,8 +33,10 @@ class Esp32Serial : public ISerial {
 public:
   Esp32Serial(unsigned long baudRate);
   bool setup() override;
-  bool writeData(const uint8_t* data, size_t length, size_t& bytesWritten) override;
+  bool writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) override;
   bool readData(uint8_t* buffer, size_t length, size_t& bytesRead) override;
+  bool availableForWrite(size_t& space) override;
+  bool update() override;
     
 private:
   unsigned long baudRate;
@@ -0,0 +1,74 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32Wifi.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 WiFi UDP Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * Station mode with modem sleep off, otherwise the radio wakes only at DTIM beacons and adds
+ * up to a few hundred ms to every datagram. Frames go to WIFI_REMOTE_IP until a datagram
+ * arrives, then to its sender, so a receiver only has to send a command to take the stream.
+ * There is one radio, the UDP socket lives in the implementation file.
+ *
+ */
+
+#ifndef ESP32_WIFI_H
+#define ESP32_WIFI_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IWifi.h"
+#include "DatagramBatch.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#ifndef WIFI_SSID
+#define WIFI_SSID "BionicArm"
+#endif
+#ifndef WIFI_PASSWORD
+#define WIFI_PASSWORD ""
+#endif
+#ifndef WIFI_REMOTE_IP
+#define WIFI_REMOTE_IP "192.168.4.2"
+#endif
+#define WIFI_CONNECT_TIMEOUT_MS 10000
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Esp32Wifi final : public IWifi {
+
+public:
+  Esp32Wifi(uint16_t localPort, uint16_t remotePort);
+  bool setup() override;
+  bool writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) override;
+  bool readData(uint8_t* buffer, size_t length, size_t& bytesRead) override;
+  bool availableForWrite(size_t& space) override;
+  bool update() override;
+
+  void setFlushDeadline(uint32_t deadlineUs);
+  void getStats(DatagramStats& stats) const;
+
+private:
+  uint16_t localPort;
+  uint16_t remotePort;
+  uint32_t remoteAddress;   // IPv4, as stored by IPAddress
+  bool connected;
+  DatagramBatch batch;
+
+  bool sendBatch();
+};
+
+#endif // ESP32_WIFI_H
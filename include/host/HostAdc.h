@@ -0,0 +1,70 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostAdc.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host ADC Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef HOST_ADC_H
+#define HOST_ADC_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IAdc.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define HOST_ADC_CONVERSION_US 10     // Simulated duration of one conversion
+#define HOST_ADC_BUFFER_SAMPLES 1024  // Simulated continuous mode buffer, older samples are lost
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+typedef uint16_t (*HostAdcSource)(uint8_t pin, uint64_t timeUs, void* context);
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostAdc final : public IAdc {
+
+public:
+  HostAdc(uint8_t pin);
+  bool setup() override;
+  bool read(uint16_t& value) override;
+  bool startContinuous(uint32_t sampleRateHz) override;
+  bool stopContinuous() override;
+  bool readBlock(uint16_t* dst, size_t n, size_t& samplesRead) override;
+
+  static void setSource(HostAdcSource source, void* context);
+  static uint16_t syntheticEmg(uint8_t pin, uint64_t timeUs, void* context);
+
+private:
+  friend class HostAdcScan;
+
+  uint8_t pin;
+  bool continuous;
+  uint32_t sampleRateHz;
+  uint64_t startUs;
+  uint64_t sampleIndex;
+
+  uint64_t sampleTimeUs(uint64_t index) const;
+
+  static HostAdcSource source;
+  static void* sourceContext;
+};
+
+#endif // HOST_ADC_H
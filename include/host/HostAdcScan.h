@@ -0,0 +1,57 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostAdcScan.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host multi-channel ADC scan header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Samples the HostAdc signal source of every pin on the simulated clock. Scan k starts at
+ * startUs + k / scanRateHz and channel c is converted HOST_ADC_CONVERSION_US * c later.
+ *
+ */
+
+#ifndef HOST_ADC_SCAN_H
+#define HOST_ADC_SCAN_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IAdcScan.h"
+#include "HostAdc.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostAdcScan : public IAdcScan {
+
+public:
+  HostAdcScan(const uint8_t* pins, uint8_t count);
+  bool setup() override;
+  uint8_t channelCount() const override;
+  bool startScan(uint32_t scanRateHz) override;
+  bool stopScan() override;
+  bool readScans(uint16_t* const* channels, uint32_t* timestampsUs, size_t maxScans,
+                 size_t& scansRead) override;
+
+private:
+  uint8_t pins[ADC_SCAN_MAX_CHANNELS];
+  uint8_t count;
+  bool scanning;
+  uint32_t scanRateHz;
+  uint64_t startUs;
+  uint64_t scanIndex;
+
+  uint64_t scanTimeUs(uint64_t index) const;
+};
+
+#endif // HOST_ADC_SCAN_H
@@ -0,0 +1,50 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostClock.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Simulated clock for the native host build
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * Virtual time base of the host build. Time only moves when the code under simulation waits
+ * (delay, ADC conversions, ...), so a run is deterministic and executes as fast as the host CPU
+ * allows instead of at wall-clock speed.
+ */
+class HostClock {
+
+public:
+  static uint64_t nowUs();
+  static void advance(uint64_t us);
+  static void advanceTo(uint64_t timeUs);
+  static void reset();
+  static void setLimit(uint64_t limitUs);
+
+private:
+  static uint64_t timeUs;
+  static uint64_t limitUs;
+};
+
+#endif // HOST_CLOCK_H
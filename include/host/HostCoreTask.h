@@ -0,0 +1,65 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostCoreTask.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host pinned thread header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Stands in for the pinned FreeRTOS task with a std::thread bound to one CPU (the core number
+ * modulo the CPUs of the host), so the split between cores can be measured on Linux. The
+ * priority is ignored. Periods run on the steady clock in real time, not on the simulated
+ * HostClock, so this backend is meant for measurements rather than deterministic runs.
+ *
+ */
+
+#ifndef HOST_CORE_TASK_H
+#define HOST_CORE_TASK_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "ICoreTask.h"
+#include <atomic>
+#ifdef HOST_NATIVE
+#include <thread>
+#endif
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostCoreTask final : public ICoreTask {
+
+public:
+  HostCoreTask(const char* name, uint8_t core, uint8_t priority);
+  ~HostCoreTask();
+  bool start(CoreTaskStep step, void* context, uint32_t periodUs) override;
+  bool stop() override;
+  bool getStats(CoreTaskStats& stats) const override;
+
+private:
+  const char* name;
+  uint8_t core;
+  CoreTaskStep step;
+  void* context;
+  uint32_t periodUs;
+#ifdef HOST_NATIVE
+  std::thread thread; // Held by value, so the task lives in the static arena with its handle
+#endif
+  std::atomic<bool> running;
+  std::atomic<uint32_t> steps;
+  std::atomic<uint32_t> overruns;
+
+  void loop();
+};
+
+#endif // HOST_CORE_TASK_H
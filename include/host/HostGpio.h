@@ -0,0 +1,72 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostGpio.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host GPIO Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef HOST_GPIO_H
+#define HOST_GPIO_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IGpio.h"
+#include "IGpioPort.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define HOST_GPIO_PIN_COUNT 64
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * Simulated pins. An input reads the level set with setLevel() (HIGH once pulled up), unless a
+ * closed switch connects it to an output driven LOW, which is how a button matrix key pulls its
+ * column down. The change interrupts of HostGpioPort are called synchronously from the call that
+ * changed the level.
+ */
+class HostGpio final : public IGpio {
+
+public:
+  HostGpio(uint8_t pin, uint8_t mode);
+  bool setup() override;
+  bool write(uint8_t state) override;
+  bool read(uint8_t& state) override;
+
+  static void setLevel(uint8_t pin, uint8_t level);
+  static uint8_t getLevel(uint8_t pin);
+  static void setSwitch(uint8_t pinA, uint8_t pinB, bool closed);
+
+private:
+  friend class HostGpioPort;
+
+  uint8_t pin;
+  uint8_t mode;
+
+  static uint8_t levels[HOST_GPIO_PIN_COUNT];
+  static uint8_t modes[HOST_GPIO_PIN_COUNT];
+  static uint64_t switches[HOST_GPIO_PIN_COUNT];   // Bit p: closed switch to pin p
+  static GpioCallback callbacks[HOST_GPIO_PIN_COUNT];
+  static void* contexts[HOST_GPIO_PIN_COUNT];
+  static uint8_t notifiedLevels[HOST_GPIO_PIN_COUNT];
+
+  static uint8_t resolve(uint8_t pin);
+  static void propagate();
+};
+
+#endif // HOST_GPIO_H
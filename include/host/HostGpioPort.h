@@ -0,0 +1,52 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostGpioPort.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host GPIO Port Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Packs the simulated HostGpio pins into a bitfield. Writes update every pin first and raise
+ * the change handlers once, like a single register store on the board.
+ *
+ */
+
+#ifndef HOST_GPIO_PORT_H
+#define HOST_GPIO_PORT_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IGpioPort.h"
+#include "HostGpio.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostGpioPort : public IGpioPort {
+
+public:
+  HostGpioPort(const uint8_t* pins, uint8_t count, uint8_t mode);
+  bool setup() override;
+  uint8_t pinCount() const override;
+  bool write(uint32_t mask, uint32_t levels) override;
+  bool read(uint32_t& levels) override;
+  bool attachChangeInterrupt(GpioCallback callback, void* context) override;
+  bool detachChangeInterrupt() override;
+
+private:
+  uint8_t pins[GPIO_PORT_MAX_PINS];
+  uint8_t count;
+  uint8_t mode;
+};
+
+#endif // HOST_GPIO_PORT_H
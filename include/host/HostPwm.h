@@ -0,0 +1,53 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostPwm.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host PWM Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef HOST_PWM_H
+#define HOST_PWM_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IPwm.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define HOST_PWM_PIN_COUNT 64
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostPwm final : public IPwm {
+
+public:
+  HostPwm(uint8_t pin);
+  bool setup() override;
+  bool write(uint8_t dutyCycle) override;
+
+  static uint8_t getDuty(uint8_t pin);
+
+private:
+  friend class HostPwmGroup;
+
+  uint8_t pin;
+
+  static uint8_t duties[HOST_PWM_PIN_COUNT];
+};
+
+#endif // HOST_PWM_H
@@ -0,0 +1,60 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostPwmGroup.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host PWM group header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Commits update the HostPwm duty table, so HostPwm::getDuty() observes both drivers, and
+ * record the simulated time of the commit.
+ *
+ */
+
+#ifndef HOST_PWM_GROUP_H
+#define HOST_PWM_GROUP_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IPwmGroup.h"
+#include "HostPwm.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define HOST_PWM_GROUP_MAX_CHANNELS 16
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostPwmGroup : public IPwmGroup {
+
+public:
+  HostPwmGroup(const uint8_t* pins, uint8_t count);
+  bool setup() override;
+  uint8_t channelCount() const override;
+  bool stage(uint8_t channel, uint8_t dutyCycle) override;
+  bool commit() override;
+
+  uint32_t getCommitCount() const;
+  uint64_t getLastCommitUs() const;
+
+private:
+  uint8_t pins[HOST_PWM_GROUP_MAX_CHANNELS];
+  uint8_t staged[HOST_PWM_GROUP_MAX_CHANNELS];
+  uint8_t count;
+  uint32_t commitCount;
+  uint64_t lastCommitUs;
+};
+
+#endif // HOST_PWM_GROUP_H
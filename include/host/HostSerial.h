@@ -0,0 +1,59 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostSerial.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host Serial Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef HOST_SERIAL_H
+#define HOST_SERIAL_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "ISerial.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define HOST_SERIAL_TX_FIFO 128   // Bytes, same as the ESP32 UART hardware FIFO
+#define HOST_SERIAL_MAX_SPANS 16  // Spans per writev() call, more take several calls
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostSerial : public ISerial {
+
+public:
+  HostSerial(unsigned long baudRate);
+  bool setup() override;
+  bool writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) override;
+  bool readData(uint8_t* buffer, size_t length, size_t& bytesRead) override;
+  bool availableForWrite(size_t& space) override;
+  bool update() override;
+
+  static void attach(int rxFd, int txFd);
+
+private:
+  unsigned long baudRate;
+  uint64_t txIdleUs;        // Simulated time the last accepted byte is shifted out
+
+  uint64_t transmitUs(size_t bytes) const;
+
+  static int rxFd;
+  static int txFd;
+};
+
+#endif // HOST_SERIAL_H
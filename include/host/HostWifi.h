@@ -0,0 +1,66 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostWifi.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host UDP socket Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Stands in for the radio with a non-blocking POSIX UDP socket on the loopback interface, so
+ * the batching and the receivers can be measured on Linux. Like the ESP32 backend it answers
+ * the sender of the last received datagram. Flush deadlines run on micros(), the simulated
+ * clock; the socket itself runs in real time.
+ *
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IWifi.h"
+#include "DatagramBatch.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class HostWifi final : public IWifi {
+
+public:
+  HostWifi(uint16_t localPort, uint16_t remotePort);
+  ~HostWifi();
+  bool setup() override;
+  bool writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) override;
+  bool readData(uint8_t* buffer, size_t length, size_t& bytesRead) override;
+  bool availableForWrite(size_t& space) override;
+  bool update() override;
+
+  void setFlushDeadline(uint32_t deadlineUs);
+  void getStats(DatagramStats& stats) const;
+
+private:
+  uint16_t localPort;
+  uint16_t remotePort;
+  uint32_t remoteAddress;   // IPv4, network byte order
+  int socketFd;
+  DatagramBatch batch;
+
+  // Received datagram, handed out over several readData() calls if needed
+  uint8_t received[DATAGRAM_BATCH_BYTES];
+  size_t receivedLength;
+  size_t receivedOffset;
+
+  bool sendBatch();
+};
+
+#endif // HOST_WIFI_H
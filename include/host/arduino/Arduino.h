@@ -0,0 +1,89 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Arduino.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Minimal Arduino core replacement for the native host build
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Only the part of the Arduino API used outside of the hardware drivers is provided. Pin level
+ * functions (pinMode, analogRead, ...) are intentionally missing: on the host every hardware
+ * access must go through the Host* drivers created by the factories.
+ *
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define LOW           0x0
+#define HIGH          0x1
+
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Functions                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void setup();
+void loop();
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * Console port standing in for the board UART. Output goes to stdout, input comes from stdin.
+ */
+class HostSerialPort {
+
+public:
+  void begin(unsigned long baudRate);
+  void end();
+  operator bool() const;
+  size_t write(uint8_t value);
+  size_t write(const uint8_t* data, size_t length);
+  size_t print(const char* text);
+  size_t println(const char* text);
+  size_t println();
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  int available();
+  int availableForWrite();
+  size_t readBytes(uint8_t* buffer, size_t length);
+
+private:
+  bool started = false;
+};
+
+extern HostSerialPort Serial;
+
+#endif // HOST_ARDUINO_H
@@ -28,15 +28,21 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class Stm32Adc : public IAdc {
+class Stm32Adc final : public IAdc {
  
 public:
   Stm32Adc(uint8_t pin);
   bool setup() override;
   bool read(uint16_t& value) override;
+  bool startContinuous(uint32_t sampleRateHz) override;
+  bool stopContinuous() override;
+  bool readBlock(uint16_t* dst, size_t n, size_t& samplesRead) override;
     
 private:
   uint8_t pin;
+  bool continuous;
+  uint32_t periodUs;
+  uint32_t nextSampleUs;
 };
 
 #endif // STM32_ADC_H 
\ No newline at end of file
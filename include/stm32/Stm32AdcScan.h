@@ -0,0 +1,50 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Stm32AdcScan.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : STM32 multi-channel ADC scan header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+#ifndef STM32_ADC_SCAN_H
+#define STM32_ADC_SCAN_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IAdcScan.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Stm32AdcScan : public IAdcScan {
+
+public:
+  Stm32AdcScan(const uint8_t* pins, uint8_t count);
+  bool setup() override;
+  uint8_t channelCount() const override;
+  bool startScan(uint32_t scanRateHz) override;
+  bool stopScan() override;
+  bool readScans(uint16_t* const* channels, uint32_t* timestampsUs, size_t maxScans,
+                 size_t& scansRead) override;
+
+private:
+  uint8_t pins[ADC_SCAN_MAX_CHANNELS];
+  uint8_t count;
+  bool scanning;
+  uint32_t periodUs;
+  uint32_t nextScanUs;
+};
+
+#endif // STM32_ADC_SCAN_H
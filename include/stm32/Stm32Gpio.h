@@ -28,7 +28,7 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class Stm32Gpio : public IGpio {
+class Stm32Gpio final : public IGpio {
  
 public:
   Stm32Gpio(uint8_t pin, uint8_t mode);
@@ -39,6 +39,8 @@ public:
 private:
   uint8_t pin;
   uint8_t mode;
+
+  bool isInput() const;
 };
 
 #endif // STM32_GPIO_H 
\ No newline at end of file
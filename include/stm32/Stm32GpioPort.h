@@ -0,0 +1,56 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Stm32GpioPort.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : STM32 GPIO Port Implementation header file
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ * All pins must belong to the same GPIOx block. A read is one IDR load, a write one BSRR store
+ * that sets and resets pins atomically.
+ *
+ */
+
+#ifndef STM32_GPIO_PORT_H
+#define STM32_GPIO_PORT_H
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IGpioPort.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Stm32GpioPort : public IGpioPort {
+
+public:
+  Stm32GpioPort(const uint8_t* pins, uint8_t count, uint8_t mode);
+  bool setup() override;
+  uint8_t pinCount() const override;
+  bool write(uint32_t mask, uint32_t levels) override;
+  bool read(uint32_t& levels) override;
+  bool attachChangeInterrupt(GpioCallback callback, void* context) override;
+  bool detachChangeInterrupt() override;
+
+private:
+  uint8_t pins[GPIO_PORT_MAX_PINS];
+  uint16_t bits[GPIO_PORT_MAX_PINS];   // Bit of each pin in IDR and BSRR
+  uint8_t count;
+  uint8_t mode;
+  volatile uint32_t* idr;              // Registers of the GPIO block, set by setup()
+  volatile uint32_t* bsrr;
+
+  bool isInput() const;
+};
+
+#endif // STM32_GPIO_PORT_H
@@ -28,7 +28,7 @@
 /*-----------------------------------------------------------------------------------------------*/
 /* Classes                                                                                       */
 /*-----------------------------------------------------------------------------------------------*/
-class Stm32Pwm : public IPwm {
+class Stm32Pwm final : public IPwm {
  
 public:
   Stm32Pwm(uint8_t pin);
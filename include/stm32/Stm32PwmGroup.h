@@ -0,0 +1,56 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Stm32PwmGroup.h
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : STM32 PWM group header file
+ * 
+ **************************************************************************************************
+ * 
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ * 
+ **************************************************************************************************
+ *
+ * Staged duties are written back to back on commit(). The Arduino STM32 core reloads the
+ * compare registers immediately, so channels on different timers may change up to one PWM
+ * period apart.
+ *
+ */
+
+#ifndef STM32_PWM_GROUP_H 
+#define STM32_PWM_GROUP_H 
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "IPwmGroup.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define STM32_PWM_GROUP_MAX_CHANNELS 16
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+class Stm32PwmGroup : public IPwmGroup {
+ 
+public:
+  Stm32PwmGroup(const uint8_t* pins, uint8_t count);
+  bool setup() override;
+  uint8_t channelCount() const override;
+  bool stage(uint8_t channel, uint8_t dutyCycle) override;
+  bool commit() override;
+    
+private:
+  uint8_t pins[STM32_PWM_GROUP_MAX_CHANNELS];
+  uint8_t staged[STM32_PWM_GROUP_MAX_CHANNELS];
+  uint8_t count;
+  uint16_t dirty;
+};
+
+#endif // STM32_PWM_GROUP_H 
@@ -12,7 +12,7 @@
 
 #include "App.h"
 
-App::App() :  isRunning(false) {
+App::App() :  isRunning(false), taskCount(0), lastTickUs(0), elapsedUs(0), busyUs(0) {
 }
 
 App::~App() {
@@ -25,12 +25,23 @@ bool App::run() {
   if (!isRunning) {
     onStart();
     isRunning = true;
+    lastTickUs = micros();
+    elapsedUs = 0;
+    busyUs = 0;
+    for (uint8_t i = 0; i < taskCount; i++) {
+      tasks[i].nextReleaseUs = lastTickUs;
+    }
     while (isRunning) {
-    onLoop();
+      if (taskCount > 0) {
+        schedule();
+      } else {
+        onLoop();
+      }
+    }
+    return true;
   }
   return false;
 }
-}
 
 bool App::stop() {
   if (isRunning) {
@@ -38,4 +49,146 @@ bool App::stop() {
     return true;
   }
   return false;
-} 
\ No newline at end of file
+}
+
+/**************************************************************************************************
+  * @brief      Number of registered tasks
+  * @return     Task count
+  ********************************************************************************************** */
+uint8_t App::getTaskCount() const {
+  return taskCount;
+}
+
+/**************************************************************************************************
+  * @brief      Timing statistics of a task since run() started
+  * @param      taskId Id returned by addTask()
+  * @param[out] stats Copy of the statistics
+  * @return     true if the task exists
+  ********************************************************************************************** */
+bool App::getTaskStats(uint8_t taskId, AppTaskStats& stats) const {
+  if (taskId >= taskCount) {
+    return false;
+  }
+  stats = tasks[taskId].stats;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Share of the time spent in tasks since run() started
+  * @return     CPU load in per mille
+  ********************************************************************************************** */
+uint16_t App::getCpuLoad() const {
+  return elapsedUs > 0 ? (uint16_t)(busyUs * 1000 / elapsedUs) : 0;
+}
+
+/**************************************************************************************************
+  * @brief      Default loop for applications without tasks
+  * @return     Nothing
+  ********************************************************************************************** */
+void App::onLoop() {
+}
+
+/**************************************************************************************************
+  * @brief      Task body, called by the scheduler at every release of a registered task
+  * @param      taskId Id returned by addTask()
+  * @return     Nothing
+  ********************************************************************************************** */
+void App::onTask(uint8_t taskId) {
+  (void)taskId;
+}
+
+/**************************************************************************************************
+  * @brief      Register a periodic task, call from onStart()
+  * @param      name Task name for reports, must stay valid
+  * @param      periodUs Release period
+  * @param      deadlineUs Latest completion after each release, usually the period or less
+  * @param      priority Tie breaker between released tasks, 0 is the most urgent
+  * @return     Task id passed to onTask(), -1 if the table is full or the period is 0
+  ********************************************************************************************** */
+int8_t App::addTask(const char* name, uint32_t periodUs, uint32_t deadlineUs, uint8_t priority) {
+  if (taskCount >= APP_MAX_TASKS || periodUs == 0) {
+    return -1;
+  }
+  AppTask& task = tasks[taskCount];
+  task.stats = AppTaskStats{name, periodUs, deadlineUs, priority, 0, 0, 0, 0, 0, 0, 0};
+  task.nextReleaseUs = micros();
+  return (int8_t)taskCount++;
+}
+
+/**************************************************************************************************
+  * @brief      Run the most urgent released task, or idle until the next release
+  * @return     Nothing
+  * @details    Released tasks are ordered by priority, then by release time. A task that falls
+  *             more than one period behind skips the missed releases instead of running them
+  *             back to back, each skipped release counts as an overrun.
+  ********************************************************************************************** */
+void App::schedule() {
+  uint32_t now = micros();
+  elapsedUs += now - lastTickUs;
+  lastTickUs = now;
+
+  int8_t selected = -1;
+  uint32_t nextWaitUs = UINT32_MAX;
+  for (uint8_t i = 0; i < taskCount; i++) {
+    int32_t lateness = (int32_t)(now - tasks[i].nextReleaseUs);
+    if (lateness < 0) {
+      nextWaitUs = (uint32_t)-lateness < nextWaitUs ? (uint32_t)-lateness : nextWaitUs;
+      continue;
+    }
+    if (selected < 0 ||
+        tasks[i].stats.priority < tasks[selected].stats.priority ||
+        (tasks[i].stats.priority == tasks[selected].stats.priority &&
+         (int32_t)(tasks[i].nextReleaseUs - tasks[selected].nextReleaseUs) < 0)) {
+      selected = (int8_t)i;
+    }
+  }
+  if (selected < 0) {
+    idle(nextWaitUs);
+    return;
+  }
+
+  AppTask& task = tasks[selected];
+  AppTaskStats& stats = task.stats;
+  uint32_t releaseUs = task.nextReleaseUs;
+  uint32_t jitterUs = now - releaseUs;
+  onTask((uint8_t)selected);
+  uint32_t end = micros();
+  uint32_t executionUs = end - now;
+
+  stats.runs++;
+  stats.releases++;
+  stats.totalJitterUs += jitterUs;
+  stats.maxJitterUs = jitterUs > stats.maxJitterUs ? jitterUs : stats.maxJitterUs;
+  stats.totalExecutionUs += executionUs;
+  stats.maxExecutionUs = executionUs > stats.maxExecutionUs ? executionUs : stats.maxExecutionUs;
+  if (end - releaseUs > stats.deadlineUs) {
+    stats.overruns++;
+  }
+  task.nextReleaseUs = releaseUs + stats.periodUs;
+  while ((int32_t)(end - (task.nextReleaseUs + stats.periodUs)) >= 0) {
+    task.nextReleaseUs += stats.periodUs;
+    stats.releases++;
+    stats.overruns++;
+  }
+
+  busyUs += executionUs;
+  elapsedUs += end - lastTickUs;
+  lastTickUs = end;
+}
+
+/**************************************************************************************************
+  * @brief      Wait for the next release
+  * @param      us Time to wait
+  * @return     Nothing
+  * @details    Whole milliseconds go through delay() so the RTOS can run other tasks, the rest
+  *             is a short busy wait that keeps the release accurate.
+  ********************************************************************************************** */
+void App::idle(uint32_t us) {
+  if (us >= 1000) {
+    delay(us / 1000);
+    us %= 1000;
+  }
+  if (us > 0) {
+    delayMicroseconds(us);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,1129 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Benchmark.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host Benchmark Application Implementation
+ * 
+ **************************************************************************************************
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "Benchmark.h"
+#include "SpscRing.h"
+#include "Biquad.h"
+#include "GestureClassifier.h"
+#include "GestureModelData.h"
+#include "LatencyTrace.h"
+#include "ButtonMatrix.h"
+#include "HostClock.h"
+#include "HostGpio.h"
+#include "HostAdc.h"
+#include "MotorDriver.h"
+#include "StaticEmgSensor.h"
+#include "StaticMotorDriver.h"
+#include "StaticArena.h"
+#include "Communication.h"
+#include "HostSerial.h"
+#include "CommandFrame.h"
+#include "HostWifi.h"
+#include "DatagramBatch.h"
+#include "EmgFrame.h"
+#include "EmgCodec.h"
+#include "BionicArm.h"
+#include "CoreTaskFactory.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+const uint32_t ringItems = 20000000;
+const size_t ringBlockSize = 64;
+const size_t biquadChannels = 8;
+const size_t biquadBlockSize = 64;
+const uint32_t biquadBlocks = 200000;
+const uint32_t classifierWindows = 2000000;
+const uint32_t tracePairs = 10000000;
+const uint32_t traceControlPeriodUs = 1000;   // Fastest task of the FullArm schedule
+const uint32_t traceStagesPerPeriod = 6;      // Worst case: every BionicArm stage in one period
+const uint32_t buttonIdleUpdates = 10000000;
+const uint32_t buttonPresses = 1000;
+const uint8_t buttonBounces = 5;              // Edges per press and per release, odd
+const uint32_t buttonBounceUs = 300;
+const uint32_t halCalls = 20000000;
+const size_t linkFrameBytes = 165;            // Encoded DatasetGeneration packet
+const uint32_t linkFrames = 1000;
+const uint32_t linkFramePeriodUs = 20000;     // 70 % of the 115200 baud link
+const uint32_t linkUpdatePeriodUs = 1000;
+const uint32_t linkStalledFrames = 100;
+const size_t commandStreamBytes = 1 << 20;
+const uint32_t commandPasses = 20;
+const size_t commandStepBytes = 64;           // COMMAND_BYTES_PER_STEP of BionicArm
+const uint32_t commandStepPeriodUs = 10000;   // TELEMETRY_PERIOD_US of BionicArm
+const uint16_t wifiPort = 4310;               // Sender port, the receiver listens on the next
+const uint32_t wifiFrames = 20000;
+const uint32_t wifiFramePeriodUs = 1000;      // 165 KB/s, 14 times the 115200 baud link
+const uint32_t wifiBurstFrames = 200000;
+const uint16_t transportSamples = 100;        // DATASET_SAMPLES_PER_PACKET
+const uint32_t transportFrames = 2000000;
+const uint16_t codecFrameSamples = 100;       // DATASET_SAMPLES_PER_PACKET
+const uint32_t codecSyntheticSeconds = 60;
+const uint32_t codecMinSamples = 20000000;    // Samples coded per timing, recording repeated
+const uint32_t pipelineSamples = 20000000;
+const size_t pipelineRecordingSamples = 60000; // Synthetic EMG acquired again and again
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+// Feature window handed from the acquisition step to the control step
+struct PipelineWindow {
+  EmgFeatureVector features;
+  uint32_t queuedTicks;       // LatencyTrace::now() when queued
+};
+
+// The acquisition and control stages of BionicArm, fed from memory as fast as they can run
+struct Pipeline {
+  const uint16_t* recording;
+  BiquadChain<EMG_FILTER_SECTIONS, 1> filter;
+  EmgFeatures features;
+  GestureClassifier classifier;
+  SpscRing<PipelineWindow, FEATURE_QUEUE_WINDOWS> queue;
+  LatencyTrace trace;
+
+  // Acquisition side
+  uint32_t acquired;
+  bool pending;               // window could not be queued yet
+  PipelineWindow window;
+  std::atomic<bool> acquisitionDone;
+
+  // Control side
+  std::atomic<uint32_t> classified;
+  uint32_t checksum;
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+BionicArmApp* BionicArmApp::instance = nullptr;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Helpers                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Compiler barrier ending each iteration of a timed loop. Once the static path is inlined, the
+// compiler could otherwise merge the iterations or drop the ones whose stores it can see through.
+static inline void keepIteration() {
+  asm volatile("" ::: "memory");
+}
+
+// Constant ADC input, so that only the driver path is measured
+static uint16_t constantSource(uint8_t pin, uint64_t timeUs, void* context) {
+  (void)pin;
+  (void)timeUs;
+  (void)context;
+  return EMG_ADC_MIDSCALE;
+}
+
+// Command handler counting its calls, context is the counter
+static uint8_t countCommand(void* context, const uint8_t* payload, uint8_t length) {
+  (void)payload;
+  (void)length;
+  (*(uint32_t*)context)++;
+  return COMMAND_OK;
+}
+
+// Empty a non-blocking UDP socket receiving linkFrameBytes frames stamped with their send time
+static void drainDatagrams(int socketFd, uint32_t& frames, uint64_t& latencyUs,
+                           uint32_t& maxLatencyUs) {
+  uint8_t datagram[DATAGRAM_BATCH_BYTES];
+  ssize_t received;
+  while ((received = recv(socketFd, datagram, sizeof(datagram), MSG_DONTWAIT)) > 0) {
+    for (ssize_t offset = 0; offset + (ssize_t)linkFrameBytes <= received;
+         offset += linkFrameBytes) {
+      uint32_t stampUs;
+      memcpy(&stampUs, &datagram[offset], sizeof(stampUs));
+      uint32_t latency = (uint32_t)HostClock::nowUs() - stampUs;
+      latencyUs += latency;
+      maxLatencyUs = latency > maxLatencyUs ? latency : maxLatencyUs;
+      frames++;
+    }
+  }
+}
+
+// Acquisition stage: filter one block and queue the finished windows, yield while the queue is full
+static void pipelineAcquire(void* context) {
+  Pipeline* pipeline = (Pipeline*)context;
+  if (pipeline->pending) {
+    pipeline->window.queuedTicks = LatencyTrace::now();
+    if (!pipeline->queue.push(pipeline->window)) {
+      std::this_thread::yield();
+      return;
+    }
+    pipeline->pending = false;
+  }
+  if (pipeline->acquired >= pipelineSamples) {
+    pipeline->acquisitionDone.store(true, std::memory_order_release);
+    std::this_thread::yield();
+    return;
+  }
+  int16_t block[EMG_BLOCK_SIZE];
+  for (size_t i = 0; i < EMG_BLOCK_SIZE; i++) {
+    block[i] = (int16_t)(pipeline->recording[(pipeline->acquired + i) %
+                                             pipelineRecordingSamples] - EMG_ADC_MIDSCALE);
+  }
+  pipeline->acquired += EMG_BLOCK_SIZE;
+  pipeline->filter.process(0, block, block, EMG_BLOCK_SIZE);
+  for (size_t i = 0; i < EMG_BLOCK_SIZE; i++) {
+    if (pipeline->features.push(block[i], pipeline->window.features)) {
+      pipeline->pending = true;   // One window per block at most, EMG_HOP > EMG_BLOCK_SIZE
+    }
+  }
+}
+
+// Control stage: classify every queued window, yield while the queue is empty
+static void pipelineControl(void* context) {
+  Pipeline* pipeline = (Pipeline*)context;
+  PipelineWindow window;
+  bool popped = false;
+  while (pipeline->queue.pop(window)) {
+    pipeline->trace.endFrom(0, window.queuedTicks);
+    uint8_t gestureId = 0;
+    pipeline->classifier.classify(window.features, gestureId);
+    pipeline->checksum += gestureId;
+    pipeline->classified.fetch_add(1, std::memory_order_release);
+    popped = true;
+  }
+  if (!popped) {
+    std::this_thread::yield();
+  }
+}
+
+// Time stamp counter where the CPU has one, 0 elsewhere
+static uint64_t cycleCount() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Get singleton instance
+  * @return     Reference to singleton instance
+  ********************************************************************************************** */
+BionicArmApp& BionicArmApp::getInstance() {
+  if (instance == nullptr) {
+    // The constructor is private, so the arena only provides the memory
+    instance = new (StaticArena::allocate(sizeof(BionicArmApp),
+                                          alignof(BionicArmApp))) BionicArmApp();
+  }
+  return *instance;
+}
+
+/**************************************************************************************************
+  * @brief      Constructor
+  * @return     Nothing
+  ********************************************************************************************** */
+BionicArmApp::BionicArmApp() : App() {
+}
+
+/**************************************************************************************************
+  * @brief      Destructor
+  * @return     Nothing
+  ********************************************************************************************** */
+BionicArmApp::~BionicArmApp() {
+  if (instance == this) {
+    instance = nullptr;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Protected methods                                                                             */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Start application
+  * @return     Nothing
+  ********************************************************************************************** */
+void BionicArmApp::onStart() {
+  Serial.begin(115200);
+  Serial.println("Benchmark Application Started");
+}
+
+/**************************************************************************************************
+  * @brief      Run every benchmark once, then stop
+  * @return     Nothing
+  ********************************************************************************************** */
+void BionicArmApp::onLoop() {
+  benchmarkSpscRing();
+  benchmarkBiquad();
+  benchmarkClassifier();
+  benchmarkLatencyTrace();
+  benchmarkButtonMatrix();
+  benchmarkStaticHal();
+  benchmarkCommunication();
+  benchmarkCommandParser();
+  benchmarkWifi();
+  benchmarkTransport();
+  benchmarkCodec();
+  benchmarkPipeline();
+
+  // Drivers of the modules built above stay reserved, the arena never releases memory
+  char line[96];
+  if (StaticArena::formatReport(line, sizeof(line)) > 0) {
+    Serial.printf("Static %s", line);
+  }
+  stop();
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      SpscRing throughput between two threads, item by item and by blocks
+  * @return     Nothing
+  * @details    The consumer checks the sequence so that lost or reordered items are reported.
+  *             Both sides yield when blocked so the figures stay meaningful on a single core.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkSpscRing() {
+  static SpscRing<uint32_t, 1024> ring;
+  uint32_t errors = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread consumer([&errors]() {
+    uint32_t expected = 0;
+    uint32_t item;
+    while (expected < ringItems) {
+      if (ring.pop(item)) {
+        errors += (item != expected);
+        expected++;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  for (uint32_t i = 0; i < ringItems; ) {
+    if (ring.push(i)) {
+      i++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  consumer.join();
+  double seconds = elapsedSeconds(start);
+  Serial.printf("SpscRing push/pop      : %7.1f Mitems/s  %5.2f ns/item  errors %u\n",
+                ringItems / seconds / 1e6, seconds * 1e9 / ringItems, errors);
+
+  static SpscRing<uint16_t, 4096> blockRing;
+  errors = 0;
+  start = std::chrono::steady_clock::now();
+  std::thread blockConsumer([&errors]() {
+    uint16_t block[ringBlockSize];
+    uint32_t received = 0;
+    while (received < ringItems) {
+      size_t count = blockRing.popBlock(block, ringBlockSize);
+      if (count == 0) {
+        std::this_thread::yield();
+      }
+      for (size_t i = 0; i < count; i++) {
+        errors += (block[i] != (uint16_t)(received + i));
+      }
+      received += count;
+    }
+  });
+  uint16_t block[ringBlockSize];
+  for (uint32_t sent = 0; sent < ringItems; ) {
+    for (size_t i = 0; i < ringBlockSize; i++) {
+      block[i] = (uint16_t)(sent + i);
+    }
+    size_t pushed = 0;
+    while (pushed < ringBlockSize) {
+      if (blockRing.size() <= blockRing.capacity() - ringBlockSize) {
+        pushed = blockRing.pushBlock(block, ringBlockSize);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    sent += ringBlockSize;
+  }
+  blockConsumer.join();
+  seconds = elapsedSeconds(start);
+  Serial.printf("SpscRing block of %3u  : %7.1f Msamples/s  %5.2f ns/sample  errors %u  overruns %u\n",
+                (unsigned)ringBlockSize, ringItems / seconds / 1e6, seconds * 1e9 / ringItems,
+                errors, blockRing.overruns());
+}
+
+/**************************************************************************************************
+  * @brief      Cost of the EMG preset filter chain per sample and channel
+  * @return     Nothing
+  * @details    Eight channels at 2 kHz filtered block by block, the way a multi-channel
+  *             acquisition would call it. The checksum keeps the compiler from dropping work.
+  *             Cycles come from the time stamp counter and read 0 on hosts without one.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkBiquad() {
+  static constexpr BiquadCascade<3> cascade = BiquadDesign::emgPreset(2000.0, 50.0);
+  static BiquadChain<3, biquadChannels> chain(cascade);
+  static int16_t input[biquadChannels][biquadBlockSize];
+  int16_t output[biquadBlockSize];
+  uint32_t seed = 1;
+  int32_t checksum = 0;
+  for (size_t c = 0; c < biquadChannels; c++) {
+    for (size_t i = 0; i < biquadBlockSize; i++) {
+      seed = seed * 1664525u + 1013904223u;
+      input[c][i] = (int16_t)((int32_t)(seed >> 20) - 2048);
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  uint64_t startCycles = cycleCount();
+  for (uint32_t b = 0; b < biquadBlocks; b++) {
+    for (size_t c = 0; c < biquadChannels; c++) {
+      chain.process(c, input[c], output, biquadBlockSize);
+      checksum += output[biquadBlockSize - 1];
+    }
+  }
+  uint64_t cycles = cycleCount() - startCycles;
+  double seconds = elapsedSeconds(start);
+  double samples = (double)biquadBlocks * biquadChannels * biquadBlockSize;
+  Serial.printf("Biquad 3 sections x %zu : %7.1f Msamples/s  %5.2f ns/sample  %5.1f cycles/sample"
+                "  (checksum %d)\n", biquadChannels, samples / seconds / 1e6,
+                seconds * 1e9 / samples, cycles / samples, (int)checksum);
+}
+
+/**************************************************************************************************
+  * @brief      Inference latency per feature window
+  * @return     Nothing
+  * @details    Runs the shipped model and a worst case MLP (GESTURE_MAX_HIDDEN units,
+  *             GESTURE_MAX_CLASSES classes) with pseudo-random weights. Both must stay far
+  *             below the feature hop, which is the control period of the arm.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkClassifier() {
+  static GestureModel worstCase;
+  uint32_t seed = 7;
+  auto next = [&seed]() {
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 16;
+  };
+  worstCase.classes = GESTURE_MAX_CLASSES;
+  worstCase.hidden = GESTURE_MAX_HIDDEN;
+  worstCase.hiddenShift = 6;
+  for (uint8_t f = 0; f < EMG_FEATURES_COUNT; f++) {
+    worstCase.featureOffset[f] = gestureModel.featureOffset[f];
+    worstCase.featureShift[f] = gestureModel.featureShift[f];
+  }
+  for (size_t j = 0; j < GESTURE_MAX_HIDDEN; j++) {
+    for (size_t f = 0; f < EMG_FEATURES_COUNT; f++) {
+      worstCase.hiddenWeights[j][f] = (int8_t)next();
+    }
+    worstCase.hiddenBias[j] = (int32_t)(next() & 0x3FF);
+  }
+  for (size_t k = 0; k < GESTURE_MAX_CLASSES; k++) {
+    for (size_t j = 0; j < GESTURE_MAX_INPUTS; j++) {
+      worstCase.outputWeights[k][j] = (int8_t)next();
+    }
+  }
+
+  static EmgFeatureVector windows[256];
+  for (EmgFeatureVector& w : windows) {
+    w.rms = (uint16_t)(next() & 0x7FF);
+    w.mav = (uint16_t)(w.rms * 4 / 5);
+    w.wl = next() * 4;
+    w.zc = (uint16_t)(next() & 0xFF);
+    w.ssc = (uint16_t)(next() & 0xFF);
+  }
+
+  const GestureModel* models[2] = { &gestureModel, &worstCase };
+  const char* names[2] = { "shipped", "worst case MLP" };
+  for (int m = 0; m < 2; m++) {
+    GestureClassifier classifier(*models[m]);
+    uint32_t histogram = 0;
+    auto start = std::chrono::steady_clock::now();
+    uint64_t startCycles = cycleCount();
+    for (uint32_t i = 0; i < classifierWindows; i++) {
+      uint8_t gestureId = 0;
+      classifier.classify(windows[i & 255], gestureId);
+      histogram += gestureId;
+    }
+    uint64_t cycles = cycleCount() - startCycles;
+    double seconds = elapsedSeconds(start);
+    Serial.printf("Classifier %-14s: %7.1f ns/window  %7.1f cycles/window  (%s, checksum %u)\n",
+                  names[m], seconds * 1e9 / classifierWindows,
+                  (double)cycles / classifierWindows, models[m]->hidden ? "MLP" : "LDA",
+                  histogram);
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Cost of one LatencyTrace begin()/end() pair around an empty stage
+  * @return     Nothing
+  * @details    Reported against the control period with every stage traced, the target is
+  *             below 1 %. The recorded histogram of the empty stage shows the timer resolution.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkLatencyTrace() {
+  static const char* const names[1] = { "empty" };
+  static LatencyTrace trace(names, 1);
+  auto start = std::chrono::steady_clock::now();
+  uint64_t startCycles = cycleCount();
+  for (uint32_t i = 0; i < tracePairs; i++) {
+    trace.begin(0);
+    trace.end(0);
+  }
+  uint64_t cycles = cycleCount() - startCycles;
+  double seconds = elapsedSeconds(start);
+  double pairNs = seconds * 1e9 / tracePairs;
+  LatencyReport report;
+  trace.getReport(0, report);
+  Serial.printf("LatencyTrace pair    : %7.1f ns/pair    %7.1f cycles/pair    "
+                "(%.3f %% of a %u us period with %u stages)\n",
+                pairNs, (double)cycles / tracePairs,
+                pairNs * traceStagesPerPeriod * 100.0 / (traceControlPeriodUs * 1000.0),
+                traceControlPeriodUs, traceStagesPerPeriod);
+  Serial.printf("LatencyTrace empty   : p50 %u ns  p99 %u ns  max %u ns  (overhead %u ns)\n",
+                report.p50Ns, report.p99Ns, report.maxNs, trace.getOverheadNs());
+}
+
+/**************************************************************************************************
+  * @brief      ButtonMatrix cost while idle and debounce behaviour on simulated pins
+  * @return     Nothing
+  * @details    Keys bounce buttonBounces times on press and on release. Every press must give
+  *             exactly one press and one release event and cost one scan per change, and two
+  *             held keys must both show in the bitmap. Scan times include the host pin
+  *             simulation and only compare with each other.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkButtonMatrix() {
+  static const uint8_t rowPins[3] = {12, 13, 14};
+  static const uint8_t colPins[3] = {15, 16, 17};
+  ButtonMatrix matrix(rowPins, 3, colPins, 3);
+  matrix.setup();
+  HostClock::advance(BUTTON_DEBOUNCE_US);
+  matrix.update();
+  matrix.update();
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < buttonIdleUpdates; i++) {
+    matrix.update();
+  }
+  double idleNs = elapsedSeconds(start) * 1e9 / buttonIdleUpdates;
+
+  uint32_t scans = matrix.getScanCount();
+  uint32_t presses = 0;
+  uint32_t releases = 0;
+  uint32_t wrongKeys = 0;
+  double changeSeconds = 0;
+  for (uint32_t i = 0; i < buttonPresses; i++) {
+    uint8_t row = i % 3;
+    uint8_t col = (i / 3) % 3;
+    for (uint8_t closed = 1; closed <= 2; closed++) {
+      for (uint8_t edge = 0; edge < buttonBounces; edge++) {
+        HostGpio::setSwitch(rowPins[row], colPins[col], (edge % 2 == 0) == (closed == 1));
+        HostClock::advance(buttonBounceUs);
+        matrix.update();
+      }
+      HostClock::advance(BUTTON_DEBOUNCE_US);
+      start = std::chrono::steady_clock::now();
+      matrix.update();
+      changeSeconds += elapsedSeconds(start);
+      ButtonEvent event;
+      while (matrix.getEvent(event)) {
+        presses += event.pressed;
+        releases += !event.pressed;
+        wrongKeys += event.row != row || event.col != col;
+      }
+    }
+  }
+  scans = matrix.getScanCount() - scans;
+
+  // Two keys on different rows and columns come back together in the bitmap
+  uint32_t keys = 0;
+  HostGpio::setSwitch(rowPins[0], colPins[0], true);
+  HostGpio::setSwitch(rowPins[1], colPins[2], true);
+  matrix.update();
+  HostClock::advance(BUTTON_DEBOUNCE_US);
+  matrix.update();
+  matrix.read(keys);
+  HostGpio::setSwitch(rowPins[0], colPins[0], false);
+  HostGpio::setSwitch(rowPins[1], colPins[2], false);
+
+  Serial.printf("ButtonMatrix idle    : %7.1f ns/update\n", idleNs);
+  Serial.printf("ButtonMatrix change  : %7.1f ns/scan     %u presses -> %u press, %u release "
+                "events, %u scans, %u wrong keys\n", changeSeconds * 1e9 / scans,
+                buttonPresses, presses, releases, scans, wrongKeys);
+  Serial.printf("ButtonMatrix chord   : keys 0x%03x (expected 0x021)\n", (unsigned)keys);
+}
+
+/**************************************************************************************************
+  * @brief      Cost per call of the factory drivers against the compile-time drivers
+  * @return     Nothing
+  * @details    Same module code, same host drivers: MotorDriver and EmgSensor call
+  *             arena-allocated drivers through IPwm and IAdc, PlatformMotorDriver and
+  *             PlatformEmgSensor hold them by value and call them directly. The environment
+  *             builds with link-time optimisation, so the direct calls inline the driver bodies.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkStaticHal() {
+  MotorDriver virtualMotor(2, 3);
+  PlatformMotorDriver staticMotor(4, 5);
+  virtualMotor.setup();
+  staticMotor.setup();
+  uint32_t failures = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < halCalls; i++) {
+    failures += !virtualMotor.forward((uint8_t)i);
+    keepIteration();
+  }
+  double virtualMotorNs = elapsedSeconds(start) * 1e9 / halCalls;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < halCalls; i++) {
+    failures += !staticMotor.forward((uint8_t)i);
+    keepIteration();
+  }
+  double staticMotorNs = elapsedSeconds(start) * 1e9 / halCalls;
+
+  HostAdc::setSource(constantSource, nullptr);
+  EmgSensor virtualEmg(34);
+  PlatformEmgSensor staticEmg(35);
+  virtualEmg.setup();
+  staticEmg.setup();
+  uint32_t sum = 0;
+  uint16_t value = 0;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < halCalls; i++) {
+    failures += !virtualEmg.read(value);
+    sum += value;
+    keepIteration();
+  }
+  double virtualEmgNs = elapsedSeconds(start) * 1e9 / halCalls;
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < halCalls; i++) {
+    failures += !staticEmg.read(value);
+    sum += value;
+    keepIteration();
+  }
+  double staticEmgNs = elapsedSeconds(start) * 1e9 / halCalls;
+  HostAdc::setSource(HostAdc::syntheticEmg, nullptr);
+
+  Serial.printf("Motor forward        : %7.2f ns virtual  %7.2f ns static  (%.2fx)\n",
+                virtualMotorNs, staticMotorNs, virtualMotorNs / staticMotorNs);
+  Serial.printf("EMG read             : %7.2f ns virtual  %7.2f ns static  (%.2fx)  "
+                "[%u failures, checksum %u]\n", virtualEmgNs, staticEmgNs,
+                virtualEmgNs / staticEmgNs, failures, sum);
+}
+
+/**************************************************************************************************
+  * @brief      Time the caller spends sending frames, blocking write against the transmit queue
+  * @return     Nothing
+  * @details    Output is discarded but the simulated UART keeps its timing. Frames come every
+  *             linkFramePeriodUs, the queue is serviced every linkUpdatePeriodUs. Then the link
+  *             stalls (no update) while linkStalledFrames frames are queued under each policy.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkCommunication() {
+  HostSerial::attach(-1, -1);
+  uint8_t frame[linkFrameBytes];
+  for (size_t i = 0; i < linkFrameBytes; i++) {
+    frame[i] = (uint8_t)i;
+  }
+  size_t bytesWritten;
+
+  HostSerial serial(115200);
+  serial.setup();
+  uint64_t blockedUs = 0;
+  for (uint32_t i = 0; i < linkFrames; i++) {
+    uint64_t before = HostClock::nowUs();
+    serial.writeData(frame, linkFrameBytes, bytesWritten);
+    blockedUs += HostClock::nowUs() - before;
+    HostClock::advanceTo(before + linkFramePeriodUs);
+  }
+
+  Communication communication;
+  communication.setup();
+  uint64_t queuedUs = 0;
+  double queueSeconds = 0;
+  for (uint32_t i = 0; i < linkFrames; i++) {
+    uint64_t before = HostClock::nowUs();
+    auto start = std::chrono::steady_clock::now();
+    communication.writeData(frame, linkFrameBytes, bytesWritten);
+    queueSeconds += elapsedSeconds(start);
+    queuedUs += HostClock::nowUs() - before;
+    for (uint32_t t = 0; t < linkFramePeriodUs; t += linkUpdatePeriodUs) {
+      communication.update();
+      HostClock::advance(linkUpdatePeriodUs);
+    }
+  }
+  TxQueueStats steady;
+  communication.getTxStats(steady);
+
+  TxQueueStats stalled[2];
+  const TxDropPolicy policies[2] = {TX_DROP_NEWEST, TX_DROP_OLDEST};
+  for (uint8_t p = 0; p < 2; p++) {
+    Communication link;
+    link.setup();
+    link.setDropPolicy(policies[p]);
+    for (uint32_t i = 0; i < linkStalledFrames; i++) {
+      link.writeData(frame, linkFrameBytes, bytesWritten);
+    }
+    link.getTxStats(stalled[p]);
+  }
+  HostSerial::attach(STDIN_FILENO, STDOUT_FILENO);
+
+  Serial.printf("Link blocking write  : %7.1f us/frame waited (simulated, %u-byte frames)\n",
+                (double)blockedUs / linkFrames, (unsigned)linkFrameBytes);
+  Serial.printf("Link queued write    : %7.1f us/frame waited, %5.1f ns/frame host  "
+                "[%u queued, %u dropped, %u bytes sent]\n", (double)queuedUs / linkFrames,
+                queueSeconds * 1e9 / linkFrames, steady.framesQueued, steady.framesDropped,
+                steady.bytesSent);
+  Serial.printf("Link stalled         : drop-newest %u dropped, drop-oldest %u dropped "
+                "(%u frames, %u pending bytes each)\n", stalled[0].framesDropped,
+                stalled[1].framesDropped, linkStalledFrames, (unsigned)stalled[0].bytesPending);
+}
+
+/**************************************************************************************************
+  * @brief      CommandParser throughput and worst step on a noisy command stream
+  * @return     Nothing
+  * @details    The stream mixes frames of every length with noise bytes, one frame in eight
+  *             has a corrupted byte. Every valid frame must be dispatched. The stream is
+  *             parsed in commandStepBytes chunks, as BionicArm does once per telemetry step,
+  *             and the slowest chunk is compared with the step period.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkCommandParser() {
+  static const CommandHandler handlers[] = {
+    { 0x01, 2, countCommand },
+    { 0x02, 1, countCommand },
+    { 0x03, 1, countCommand },
+    { 0x04, 0, countCommand },
+    { 0x05, COMMAND_MAX_PAYLOAD, countCommand }
+  };
+  static const uint8_t lengths[] = {2, 1, 1, 0, COMMAND_MAX_PAYLOAD};
+
+  std::vector<uint8_t> stream;
+  stream.reserve(commandStreamBytes + COMMAND_FRAME_BYTES(COMMAND_MAX_PAYLOAD) + 4);
+  uint32_t seed = 3;
+  uint32_t validFrames = 0;
+  uint32_t corruptedFrames = 0;
+  while (stream.size() < commandStreamBytes) {
+    seed = seed * 1664525u + 1013904223u;
+    for (uint32_t noise = (seed >> 28) & 3; noise > 0; noise--) {
+      stream.push_back((uint8_t)(seed >> (noise * 8)) & 0x7F);
+    }
+    uint8_t kind = (seed >> 8) % 5;
+    uint8_t payload[COMMAND_MAX_PAYLOAD];
+    for (uint8_t i = 0; i < COMMAND_MAX_PAYLOAD; i++) {
+      payload[i] = (uint8_t)(seed >> i);
+    }
+    uint8_t frame[COMMAND_FRAME_BYTES(COMMAND_MAX_PAYLOAD)];
+    size_t frameLength;
+    CommandFrame::encode(handlers[kind].id, payload, lengths[kind], frame, sizeof(frame),
+                         frameLength);
+    if ((seed >> 12) % 8 == 0) {
+      frame[frameLength - 1] ^= 0x5A;
+      corruptedFrames++;
+    } else {
+      validFrames++;
+    }
+    stream.insert(stream.end(), frame, frame + frameLength);
+  }
+
+  uint32_t dispatched = 0;
+  uint32_t errors = 0;
+  std::vector<double> stepNs;
+  stepNs.reserve((stream.size() / commandStepBytes + 1) * commandPasses);
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0; pass < commandPasses; pass++) {
+    CommandParser parser(handlers, sizeof(handlers) / sizeof(handlers[0]), &dispatched);
+    uint8_t id;
+    uint8_t status;
+    for (size_t offset = 0; offset < stream.size(); offset += commandStepBytes) {
+      size_t end = offset + commandStepBytes < stream.size() ? offset + commandStepBytes
+                                                             : stream.size();
+      auto stepStart = std::chrono::steady_clock::now();
+      for (size_t i = offset; i < end; i++) {
+        parser.push(stream[i], id, status);
+      }
+      stepNs.push_back(elapsedSeconds(stepStart) * 1e9);
+    }
+    errors += parser.errors();
+  }
+  double seconds = elapsedSeconds(start);
+  double bytes = (double)stream.size() * commandPasses;
+  std::sort(stepNs.begin(), stepNs.end());
+  double p999StepNs = stepNs[stepNs.size() * 999 / 1000];
+
+  // The maximum also catches host preemptions, the 99.9th percentile is the parser
+  Serial.printf("CommandParser        : %7.2f ns/byte  %7.1f MB/s  %zu-byte step p99.9 %.2f us "
+                "(%.4f %% of %u us), max %.2f us\n", seconds * 1e9 / bytes,
+                bytes / seconds / 1e6, commandStepBytes, p999StepNs / 1000,
+                p999StepNs * 100 / (commandStepPeriodUs * 1e3), commandStepPeriodUs,
+                stepNs.back() / 1000);
+  Serial.printf("CommandParser frames : %u valid -> %u dispatched, %u corrupted -> %u errors "
+                "(per pass)\n", validFrames, dispatched / commandPasses, corruptedFrames,
+                errors / commandPasses);
+}
+
+/**************************************************************************************************
+  * @brief      HostWifi over loopback, one datagram per frame against deadline batching
+  * @return     Nothing
+  * @details    DatasetGeneration-sized frames carry their send time. The paced run sends one
+  *             frame every wifiFramePeriodUs of simulated time and reports how long frames wait
+  *             in the batch. The burst run sends as fast as the host allows and reports the
+  *             wall-clock throughput, which is bounded by the sendto() calls.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkWifi() {
+  int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(wifiPort + 1);
+  int receiveBuffer = 1 << 20;
+  if (receiver < 0 || bind(receiver, (struct sockaddr*)&address, sizeof(address)) != 0) {
+    Serial.println("WiFi loopback        : cannot bind the receiver, skipped");
+    if (receiver >= 0) {
+      close(receiver);
+    }
+    return;
+  }
+  setsockopt(receiver, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+
+  const uint32_t deadlines[2] = {0, WIFI_FLUSH_DEADLINE_US};
+  const char* names[2] = {"WiFi one per frame   ", "WiFi batched         "};
+  uint8_t frame[linkFrameBytes];
+  for (size_t i = 0; i < linkFrameBytes; i++) {
+    frame[i] = (uint8_t)i;
+  }
+  size_t bytesWritten;
+  for (uint8_t d = 0; d < 2; d++) {
+    HostWifi wifi(wifiPort, wifiPort + 1);
+    if (!wifi.setup()) {
+      Serial.println("WiFi loopback        : cannot bind the sender, skipped");
+      break;
+    }
+    wifi.setFlushDeadline(deadlines[d]);
+
+    uint32_t pacedFrames = 0;
+    uint64_t latencyUs = 0;
+    uint32_t maxLatencyUs = 0;
+    for (uint32_t i = 0; i < wifiFrames; i++) {
+      uint32_t nowUs = (uint32_t)HostClock::nowUs();
+      memcpy(frame, &nowUs, sizeof(nowUs));
+      wifi.writeData(frame, linkFrameBytes, bytesWritten);
+      wifi.update();
+      drainDatagrams(receiver, pacedFrames, latencyUs, maxLatencyUs);
+      HostClock::advance(wifiFramePeriodUs);
+    }
+    for (uint32_t t = 0; t < deadlines[d]; t += wifiFramePeriodUs) {
+      HostClock::advance(wifiFramePeriodUs);
+      wifi.update();
+      drainDatagrams(receiver, pacedFrames, latencyUs, maxLatencyUs);
+    }
+    DatagramStats paced;
+    wifi.getStats(paced);
+
+    uint32_t burstFrames = 0;
+    uint64_t burstLatencyUs = 0;
+    uint32_t burstMaxLatencyUs = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < wifiBurstFrames; i++) {
+      wifi.writeData(frame, linkFrameBytes, bytesWritten);
+      if ((i & 63) == 63) {
+        drainDatagrams(receiver, burstFrames, burstLatencyUs, burstMaxLatencyUs);
+      }
+    }
+    HostClock::advance(deadlines[d]);
+    wifi.update();
+    drainDatagrams(receiver, burstFrames, burstLatencyUs, burstMaxLatencyUs);
+    double seconds = elapsedSeconds(start);
+    DatagramStats total;
+    wifi.getStats(total);
+
+    Serial.printf("%s: paced %u/%u frames, %.2f frames/datagram, wait avg %.0f us max %u us "
+                  "(simulated)\n", names[d], pacedFrames, wifiFrames,
+                  (double)paced.framesSent / paced.datagramsSent,
+                  (double)latencyUs / (pacedFrames ? pacedFrames : 1), maxLatencyUs);
+    Serial.printf("%s: burst %u/%u frames, %.0f frames/s, %.1f MB/s, %u dropped by the socket\n",
+                  names[d], burstFrames, wifiBurstFrames, burstFrames / seconds,
+                  burstFrames * (double)linkFrameBytes / seconds / 1e6,
+                  total.framesDropped - paced.framesDropped);
+  }
+  close(receiver);
+  Serial.printf("Serial link          : %.1f KB/s at 115200 baud\n", 115200 / 10 / 1e3);
+}
+
+/**************************************************************************************************
+  * @brief      Cost of building and queueing frames without intermediate copies
+  * @return     Nothing
+  * @details    EmgFrame::encode() packs and COBS encodes a DatasetGeneration packet in place.
+  *             Then a frame made of a header, a payload and a trailer is queued into a datagram
+  *             either assembled first in a packet buffer or gathered by writeSpans() style
+  *             spans. The datagram is reset after each frame so only the copies are measured.
+  *             The checksum keeps the compiler from dropping work.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkTransport() {
+  uint16_t samples[transportSamples];
+  for (uint16_t i = 0; i < transportSamples; i++) {
+    samples[i] = (uint16_t)(2048 + (i * 37) % 400 - 200);
+  }
+  EmgFrameHeader header = {EMG_FRAME_VERSION, EMG_FRAME_TYPE_SAMPLES, 1, 1, 0, 0,
+                           transportSamples};
+  uint8_t frame[EMG_FRAME_ENCODED_BYTES(transportSamples)];
+  size_t frameLength = 0;
+  uint32_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < transportFrames; i++) {
+    header.sequence = (uint16_t)i;
+    header.timestampUs = i * 100000;
+    EmgFrame::encode(header, samples, frame, sizeof(frame), frameLength);
+    checksum += frame[frameLength / 2];
+  }
+  double encodeSeconds = elapsedSeconds(start);
+
+  uint8_t head[EMG_FRAME_HEADER_BYTES] = {};
+  uint8_t payload[EMG_FRAME_PAYLOAD_BYTES(transportSamples)] = {};
+  uint8_t trailer[EMG_FRAME_CRC_BYTES] = {};
+  const TransportSpan spans[3] = {
+    { head, sizeof(head) },
+    { payload, sizeof(payload) },
+    { trailer, sizeof(trailer) }
+  };
+  DatagramBatch batch(0);
+  uint8_t packet[sizeof(head) + sizeof(payload) + sizeof(trailer)];
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < transportFrames; i++) {
+    head[0] = (uint8_t)i;
+    memcpy(packet, head, sizeof(head));
+    memcpy(&packet[sizeof(head)], payload, sizeof(payload));
+    memcpy(&packet[sizeof(head) + sizeof(payload)], trailer, sizeof(trailer));
+    TransportSpan whole = { packet, sizeof(packet) };
+    batch.append(&whole, 1, 0);
+    checksum += batch.data()[0];
+    batch.sent(true);
+  }
+  double assembleSeconds = elapsedSeconds(start);
+  start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < transportFrames; i++) {
+    head[0] = (uint8_t)i;
+    batch.append(spans, 3, 0);
+    checksum += batch.data()[0];
+    batch.sent(true);
+  }
+  double gatherSeconds = elapsedSeconds(start);
+
+  Serial.printf("EmgFrame encode      : %7.1f ns/frame (%u samples, %zu bytes on the wire)\n",
+                encodeSeconds * 1e9 / transportFrames, transportSamples, frameLength);
+  Serial.printf("Transport %3zu-byte   : assembled %5.1f ns/frame, gathered %5.1f ns/frame "
+                "(checksum %u)\n", sizeof(packet), assembleSeconds * 1e9 / transportFrames,
+                gatherSeconds * 1e9 / transportFrames, (unsigned)checksum);
+}
+
+/**************************************************************************************************
+  * @brief      Compression ratio and cost of EmgCodec on a recording
+  * @return     Nothing
+  * @details    The recording is the DatasetGeneration capture named by CODEC_FILE, otherwise
+  *             one minute of the host synthetic EMG. It is cut into DatasetGeneration frames,
+  *             each compressed on its own as EMG_FRAME_TYPE_RICE does, and compared with the
+  *             12-bit packed payload and with 16-bit samples. The recording is coded again
+  *             until enough samples are timed, then every frame is decoded and checked.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkCodec() {
+  std::vector<uint16_t> recording;
+  const char* path = getenv("CODEC_FILE");
+  FILE* file = path != nullptr ? fopen(path, "rb") : nullptr;
+  if (file != nullptr) {
+    EmgFrameReceiver receiver;
+    EmgFrameHeader header;
+    static uint16_t samples[EMG_FRAME_MAX_SAMPLES];
+    int byte;
+    while ((byte = fgetc(file)) != EOF) {
+      if (receiver.push((uint8_t)byte) &&
+          EmgFrame::decode(receiver.frame(), receiver.length(), header, samples,
+                           EMG_FRAME_MAX_SAMPLES) &&
+          EMG_FRAME_HAS_SAMPLES(header.type) && header.channels == 1) {
+        recording.insert(recording.end(), samples, samples + header.sampleCount);
+      }
+    }
+    fclose(file);
+  }
+  if (recording.empty()) {
+    path = "synthetic";
+    for (uint64_t t = 0; t < (uint64_t)codecSyntheticSeconds * EMG_SAMPLE_RATE_HZ; t++) {
+      recording.push_back(HostAdc::syntheticEmg(34, t * 1000000 / EMG_SAMPLE_RATE_HZ, nullptr));
+    }
+  }
+  size_t frames = recording.size() / codecFrameSamples;
+  if (frames == 0) {
+    Serial.printf("EmgCodec: %s holds less than one frame\n", path);
+    return;
+  }
+
+  const size_t frameCapacity = EMG_FRAME_PAYLOAD_BYTES(codecFrameSamples);
+  std::vector<uint8_t> coded(frames * frameCapacity);
+  std::vector<size_t> codedLength(frames);
+  size_t codedBytes = 0;
+  size_t packedFrames = 0;
+  for (size_t f = 0; f < frames; f++) {
+    if (!EmgCodec::encode(&recording[f * codecFrameSamples], codecFrameSamples, 1,
+                          &coded[f * frameCapacity], frameCapacity, codedLength[f]) ||
+        codedLength[f] >= frameCapacity) {
+      codedLength[f] = frameCapacity;   // Sent packed, as EmgFrame::encode() would
+      packedFrames++;
+    }
+    codedBytes += codedLength[f];
+  }
+
+  uint32_t passes = (uint32_t)(codecMinSamples / (frames * codecFrameSamples)) + 1;
+  double samples = (double)passes * frames * codecFrameSamples;
+  uint8_t scratch[frameCapacity];
+  size_t scratchLength = 0;
+  uint32_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  uint64_t startCycles = cycleCount();
+  for (uint32_t p = 0; p < passes; p++) {
+    for (size_t f = 0; f < frames; f++) {
+      EmgCodec::encode(&recording[f * codecFrameSamples], codecFrameSamples, 1, scratch,
+                       sizeof(scratch), scratchLength);
+      checksum += scratch[scratchLength / 2];
+    }
+  }
+  uint64_t encodeCycles = cycleCount() - startCycles;
+  double encodeSeconds = elapsedSeconds(start);
+
+  uint16_t decoded[codecFrameSamples];
+  start = std::chrono::steady_clock::now();
+  startCycles = cycleCount();
+  for (uint32_t p = 0; p < passes; p++) {
+    for (size_t f = 0; f < frames; f++) {
+      if (codedLength[f] < frameCapacity) {
+        EmgCodec::decode(&coded[f * frameCapacity], codedLength[f], 1, decoded,
+                         codecFrameSamples);
+        checksum += decoded[codecFrameSamples - 1];
+      }
+    }
+  }
+  uint64_t decodeCycles = cycleCount() - startCycles;
+  double decodeSeconds = elapsedSeconds(start);
+  double decodedSamples = (double)passes * (frames - packedFrames) * codecFrameSamples;
+
+  size_t mismatches = 0;
+  for (size_t f = 0; f < frames; f++) {
+    if (codedLength[f] < frameCapacity &&
+        (!EmgCodec::decode(&coded[f * frameCapacity], codedLength[f], 1, decoded,
+                           codecFrameSamples) ||
+         memcmp(decoded, &recording[f * codecFrameSamples], sizeof(decoded)) != 0)) {
+      mismatches++;
+    }
+  }
+
+  double rawSamples = (double)frames * codecFrameSamples;
+  Serial.printf("EmgCodec %s: %zu frames of %u samples, %zu sent packed, %s\n", path, frames,
+                codecFrameSamples, packedFrames, mismatches == 0 ? "lossless" : "MISMATCH");
+  Serial.printf("EmgCodec ratio       : %5.2f bits/sample, %4.2fx vs 12-bit packed, "
+                "%4.2fx vs 16-bit\n", codedBytes * 8.0 / rawSamples,
+                frames * frameCapacity / (double)codedBytes, rawSamples * 2.0 / codedBytes);
+  Serial.printf("EmgCodec encode      : %5.2f ns/sample  %5.1f cycles/sample\n",
+                encodeSeconds * 1e9 / samples, encodeCycles / samples);
+  if (decodedSamples > 0) {
+    Serial.printf("EmgCodec decode      : %5.2f ns/sample  %5.1f cycles/sample  %5.2f GB/s of "
+                  "samples  (checksum %u)\n", decodeSeconds * 1e9 / decodedSamples,
+                  decodeCycles / decodedSamples, decodedSamples * 2 / decodeSeconds / 1e9,
+                  (unsigned)checksum);
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Throughput of the acquisition and control stages on one core and split on two
+  * @return     Nothing
+  * @details    The same step functions run on this thread, then each on its own core task
+  *             joined by the feature queue, the way -DBIONIC_ARM_DUAL_CORE splits FullArm. The
+  *             single thread fills the queue before each control step, so both runs classify
+  *             windows in batches of up to FEATURE_QUEUE_WINDOWS and never yield on a full or
+  *             empty queue. The queue latency is the time from push to pop. Both tasks yield
+  *             when blocked, so the split stays correct on a host with a single CPU, where no
+  *             speed-up is reported.
+  ********************************************************************************************** */
+void BionicArmApp::benchmarkPipeline() {
+  static const char* const names[1] = { "queue" };
+  static uint16_t recording[pipelineRecordingSamples];
+  for (size_t i = 0; i < pipelineRecordingSamples; i++) {
+    recording[i] = HostAdc::syntheticEmg(34, (uint64_t)i * 1000000 / EMG_SAMPLE_RATE_HZ,
+                                         nullptr);
+  }
+  static Pipeline single = { recording, BiquadChain<EMG_FILTER_SECTIONS, 1>(emgFilterCascade),
+                             EmgFeatures(EMG_WINDOW, EMG_HOP, EMG_DEAD_BAND),
+                             GestureClassifier(gestureModel), {}, LatencyTrace(names, 1),
+                             0, false, {}, {false}, {0}, 0 };
+  static Pipeline split = { recording, BiquadChain<EMG_FILTER_SECTIONS, 1>(emgFilterCascade),
+                            EmgFeatures(EMG_WINDOW, EMG_HOP, EMG_DEAD_BAND),
+                            GestureClassifier(gestureModel), {}, LatencyTrace(names, 1),
+                            0, false, {}, {false}, {0}, 0 };
+
+  auto start = std::chrono::steady_clock::now();
+  while (!single.acquisitionDone.load() || !single.queue.empty()) {
+    // Fill the queue, then drain it in one control step, so neither stage waits on the other
+    while (single.queue.size() < FEATURE_QUEUE_WINDOWS && !single.acquisitionDone.load()) {
+      pipelineAcquire(&single);
+    }
+    pipelineControl(&single);
+  }
+  double singleSeconds = elapsedSeconds(start);
+
+  ICoreTask* acquisition = CoreTaskFactory::createCoreTask("acquisition", ACQUISITION_CORE,
+                                                           ACQUISITION_PRIORITY);
+  ICoreTask* control = CoreTaskFactory::createCoreTask("control", ACQUISITION_CORE + 1, 1);
+  if (acquisition == nullptr || control == nullptr) {
+    Serial.println("Pipeline: no core task on this platform");
+    return;
+  }
+  uint32_t windows = single.classified.load();
+  start = std::chrono::steady_clock::now();
+  control->start(pipelineControl, &split, 0);
+  acquisition->start(pipelineAcquire, &split, 0);
+  while (split.classified.load(std::memory_order_acquire) < windows) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  double splitSeconds = elapsedSeconds(start);
+  acquisition->stop();
+  control->stop();
+  CoreTaskStats acquisitionStats;
+  acquisition->getStats(acquisitionStats);
+  StaticArena::destroy(acquisition);
+  StaticArena::destroy(control);
+
+  LatencyReport latency;
+  split.trace.getReport(0, latency);
+  Serial.printf("Pipeline one core    : %6.1f Msamples/s (%u windows)\n",
+                pipelineSamples / singleSeconds / 1e6, (unsigned)windows);
+  unsigned cpus = std::thread::hardware_concurrency();
+  if (cpus >= 2) {
+    Serial.printf("Pipeline two cores   : %6.1f Msamples/s, %.2fx, %u CPUs on this host "
+                  "(checksum %u/%u)\n", pipelineSamples / splitSeconds / 1e6,
+                  singleSeconds / splitSeconds, cpus,
+                  (unsigned)single.checksum, (unsigned)split.checksum);
+  } else {
+    Serial.printf("Pipeline two tasks   : %6.1f Msamples/s, one CPU on this host, no speed-up "
+                  "to measure (checksum %u/%u)\n", pipelineSamples / splitSeconds / 1e6,
+                  (unsigned)single.checksum, (unsigned)split.checksum);
+  }
+  Serial.printf("Pipeline queue       : p50 %lu ns  p99 %lu ns  max %lu ns, %lu acquisition "
+                "steps, queue full %lu times\n", (unsigned long)latency.p50Ns,
+                (unsigned long)latency.p99Ns, (unsigned long)latency.maxNs,
+                (unsigned long)acquisitionStats.steps, (unsigned long)split.queue.overruns());
+}
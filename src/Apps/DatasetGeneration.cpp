@@ -14,11 +14,16 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "DatasetGeneration.h"
+#include "StaticArena.h"
+#include "StaticHal.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Constants                                                                                     */
 /*-----------------------------------------------------------------------------------------------*/
-const uint16_t numberOfSamples = 100 ; 
+const uint16_t numberOfSamples = DATASET_SCANS_PER_PACKET * DATASET_CHANNELS;
+static_assert(StaticArena::footprint<BionicArmApp, EmgArray, PlatformAdcScan, Communication,
+                                     PlatformLink>() <= STATIC_ARENA_BYTES,
+              "Application does not fit the static arena, raise STATIC_ARENA_BYTES");
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Static members                                                                                */
@@ -34,7 +39,9 @@ BionicArmApp* BionicArmApp::instance = nullptr;
   ********************************************************************************************** */
 BionicArmApp& BionicArmApp::getInstance() {
   if (instance == nullptr) {
-    instance = new BionicArmApp();
+    // The constructor is private, so the arena only provides the memory
+    instance = new (StaticArena::allocate(sizeof(BionicArmApp),
+                                          alignof(BionicArmApp))) BionicArmApp();
   }
   return *instance;
 }
@@ -44,8 +51,20 @@ BionicArmApp& BionicArmApp::getInstance() {
   * @return     Nothing
   ********************************************************************************************** */
 BionicArmApp::BionicArmApp() : App() {
-  emgSensor = new EmgSensor(34);
-  communication = new Communication();
+  const uint8_t emgPins[DATASET_CHANNELS] = DATASET_EMG_PINS;
+  emgArray = StaticArena::create<EmgArray>(emgPins, DATASET_CHANNELS);
+  communication = StaticArena::create<Communication>();
+  for (uint8_t c = 0; c < DATASET_CHANNELS; c++) {
+    acquisitionChannels[c] = acquisitionBlock[c];
+    filteredChannels[c] = filteredBlock[c];
+  }
+  sequence = 0;
+  scanIndex = 0;
+  pushedScans = 0;
+  droppedScans = 0;
+  poppedScans = 0;
+  nextGap = {};
+  gapPending = false;
 }
 
 /**************************************************************************************************
@@ -53,8 +72,8 @@ BionicArmApp::BionicArmApp() : App() {
   * @return     Nothing
   ********************************************************************************************** */
 BionicArmApp::~BionicArmApp() {
-  delete emgSensor;
-  delete communication;
+  StaticArena::destroy(emgArray);
+  StaticArena::destroy(communication);
   if (instance == this) {
     instance = nullptr;
   }
@@ -68,92 +87,140 @@ BionicArmApp::~BionicArmApp() {
   * @return     Nothing
   ********************************************************************************************** */
 void BionicArmApp::onStart() {
-  emgSensor->setup();
+  emgArray->setup();
   communication->setup();
   Serial.begin(115200);
-  delay(1000);
   Serial.println("Dataset Generation Application Started");
-  delay(100);
-  
+  // Delimit the banner so the receiver synchronises on the first frame
+  uint8_t delimiter = EMG_FRAME_DELIMITER;
+  size_t bytesWritten;
+  communication->writeData(&delimiter, 1, bytesWritten);
+  emgArray->startAcquisition(DATASET_SAMPLE_RATE_HZ);
+  acquisitionTask = addTask("acquisition", DATASET_ACQUISITION_PERIOD_US,
+                            DATASET_ACQUISITION_PERIOD_US, 0);
+  transmissionTask = addTask("transmission", DATASET_TRANSMISSION_PERIOD_US,
+                             DATASET_TRANSMISSION_PERIOD_US, 1);
 }
 
 /**************************************************************************************************
-  * @brief      Main application loop
+  * @brief      Run one release of a scheduled task
+  * @param      taskId Task being released
   * @return     Nothing
   ********************************************************************************************** */
-void BionicArmApp::onLoop() {
-  uint8_t emgData[numberOfSamples * 2];
-  uint8_t packet[numberOfSamples * 2 + 5];
-  size_t bytesWritten;
-  createSample(emgData);
-  createPacket(packet, emgData, 1);
-  communication->writeData(packet, numberOfSamples * 2 + 5, bytesWritten);
-  delay(1000);
+void BionicArmApp::onTask(uint8_t taskId) {
+  if (taskId == acquisitionTask) {
+    acquire();
+  } else if (taskId == transmissionTask) {
+    transmit();
+  }
 } 
 
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
 /**************************************************************************************************
-  * @brief      Convert a 16-bit value to two 8-bit values using decimal division
-  * @param[in]  value: The 16-bit value to convert
-  * @param[out] array: Array to store the two 8-bit values (array[0] = hundreds, array[1] = remainder)
-  * @return     true if conversion successful
+  * @brief      Acquisition stage: move converted scans from the ADC into the sample ring
+  * @return     Nothing
+  * @details    Only touches the producer side of the ring, so it can run from a timer task
+  *             independently of transmit(). Samples that do not fit are counted as overruns.
+  *             Recordings go through the same filter chain as the arm, one channel buffer at
+  *             a time, then are shifted back to mid-scale and interleaved scan by scan so they
+  *             fit the 12-bit frame format. A block that does not fit is dropped whole, so
+  *             the ring never holds a partial scan. The dropped scans are recorded in gapRing
+  *             at their place in the stream before the next block is pushed, so the frames
+  *             after them are stamped later. Each step first passes queued frames to the
+  *             link, in the same context as transmit() queues them.
   ********************************************************************************************** */
-bool BionicArmApp::toArray(uint16_t value, uint8_t* array) {
-  array[0] = value / 100 ;  // High byte
-  array[1] = value % 100;   // Low byte 
-  return true;
+void BionicArmApp::acquire() {
+  communication->update();
+  if (!emgArray->readBlock(acquisitionChannels, nullptr, DATASET_ACQUISITION_BLOCK) ||
+      !emgArray->filterBlock(acquisitionChannels, filteredChannels, DATASET_ACQUISITION_BLOCK)) {
+    return;
+  }
+  for (uint8_t c = 0; c < DATASET_CHANNELS; c++) {
+    for (uint8_t i = 0; i < DATASET_ACQUISITION_BLOCK; i++) {
+      int32_t sample = filteredBlock[c][i] + EMG_ADC_MIDSCALE;
+      interleavedBlock[i * DATASET_CHANNELS + c] =
+        (uint16_t)(sample < 0 ? 0 : (sample > 4095 ? 4095 : sample));
+    }
+  }
+  const size_t blockSamples = DATASET_ACQUISITION_BLOCK * DATASET_CHANNELS;
+  if (droppedScans > 0 && sampleRing.capacity() - sampleRing.size() >= blockSamples) {
+    // With gapRing full the drop is recorded at a later block, a little late
+    ScanGap gap = { pushedScans, droppedScans };
+    if (gapRing.push(gap)) {
+      droppedScans = 0;
+    }
+  }
+  if (!sampleRing.pushAll(interleavedBlock, blockSamples)) {
+    droppedScans += DATASET_ACQUISITION_BLOCK;
+    return;
+  }
+  pushedScans += DATASET_ACQUISITION_BLOCK;
 }
 
 /**************************************************************************************************
-  * @brief      Create a sample by reading multiple EMG values and converting them to pairs of bytes
-  * @param[out] emgData: Array to store the converted EMG samples (size = numberOfSamples * 2)
-  * @return     true if all samples were read successfully, false otherwise
+  * @brief      Transmission stage: send the packets buffered so far
+  * @return     Nothing
+  * @details    Only touches the consumer side of the ring. Packets are sent while the link
+  *             has room for a whole one, so releases skipped by the scheduler leave no
+  *             backlog and the transmit queue never drops packets it already holds. The ring
+  *             absorbs a slow link. Once it is full, acquisition drops scans, which shows up
+  *             as a timestamp jump, but sampling is never delayed.
   ********************************************************************************************** */
-bool BionicArmApp::createSample(uint8_t * emgData) {
-  uint16_t emgValue;
+void BionicArmApp::transmit() {
+  uint8_t packet[EMG_FRAME_ENCODED_BYTES(DATASET_SAMPLES_PER_PACKET)];
+  size_t packetLength;
   size_t bytesWritten;
-  uint8_t array[2];
-  for (uint16_t i = 0; i < numberOfSamples; i++) {
-    if (emgSensor->read(emgValue)) {
-      toArray(emgValue, array);
-      emgData[i * 2] = array[0];
-      emgData[i * 2 + 1] = array[1];
-      delay(10);
-    }
-    else {
-      return false;
+  size_t space;
+  while (communication->availableForWrite(space) && space >= sizeof(packet) && createSample()) {
+    if (createPacket(packet, sizeof(packet), packetLength, DATASET_LABEL)) {
+      communication->writeData(packet, packetLength, bytesWritten);
     }
   }
+}
+
+/**************************************************************************************************
+  * @brief      Take a block of EMG values from the sample ring
+  * @return     true if a whole block was taken from the sample ring, false if not enough
+  *             samples are buffered yet
+  ********************************************************************************************** */
+bool BionicArmApp::createSample() {
+  if (sampleRing.size() < numberOfSamples) {
+    return false;
+  }
+  sampleRing.popBlock(samples, numberOfSamples);
   return true;
 } 
 
 /**************************************************************************************************
-  * @brief      Create a data packet with label, EMG data and checksum
-  * @param[out] packet: Array to store the complete packet (size = numberOfSamples * 2 + 5)
-  * @param[in]  emgData: Array containing the EMG samples
+  * @brief      Create a binary frame with label, sequence number, timestamp and EMG samples
+  * @param[out] packet: Buffer receiving the encoded frame
+  * @param[in]  packetSize: Size of the packet buffer
+  * @param[out] packetLength: Number of bytes to transmit
   * @param[in]  label: Classification label for this data packet
   * @return     true if packet creation successful
-  * @details    Packet format: [label][emg data][checksum]
-  *             - label: 1 byte
-  *             - emg data: numberOfSamples * 2 bytes
-  *             - checksum: 4 bytes (split into thousands, hundreds, tens, ones)
+  * @details    See EmgFrame.h for the wire format. Samples are interleaved, DATASET_CHANNELS
+  *             per scan. The timestamp is the time of the first scan since acquisition started,
+  *             derived from the scan counter so it stays exact whatever the transmission delay.
+  *             Frames lost on the link show up as sequence gaps. Scans dropped by acquisition
+  *             show up as a timestamp jump from the first frame starting after them. The
+  *             frame they fall in keeps its start time, so its later scans are early by the
+  *             dropped time.
   ********************************************************************************************** */
-bool BionicArmApp::createPacket(uint8_t * packet, uint8_t * emgData, uint8_t label) {
-  uint8_t checkSumArray[4];
-  packet[0] = label;
-  uint32_t checkSum = 0;
-  for (uint16_t i = 1; i <= 2*numberOfSamples; i++) {
-    packet[i] = emgData[i-1];
-    checkSum += packet[i-1];
+bool BionicArmApp::createPacket(uint8_t * packet, size_t packetSize, size_t& packetLength, uint8_t label) {
+  EmgFrameHeader header;
+  header.type = DATASET_FRAME_TYPE;
+  header.label = label;
+  header.channels = DATASET_CHANNELS;
+  while ((gapPending || (gapPending = gapRing.pop(nextGap))) && nextGap.scan <= poppedScans) {
+    scanIndex += nextGap.dropped;
+    gapPending = false;
   }
-  checkSum += packet[2*numberOfSamples];
-  checkSumArray[0] = checkSum / 1000000;
-  checkSumArray[1] = (checkSum%1000000)/10000;
-  checkSumArray[2] = (checkSum%10000)/100;
-  checkSumArray[3] = (checkSum%100);
-  packet[2*numberOfSamples + 1] = checkSumArray[0];
-  packet[2*numberOfSamples + 2] = checkSumArray[1];
-  packet[2*numberOfSamples + 3] = checkSumArray[2];
-  packet[2*numberOfSamples + 4] = checkSumArray[3];
- 
-  return true;
-}
\ No newline at end of file
+  header.sequence = sequence++;
+  header.timestampUs = (uint32_t)((uint64_t)scanIndex * 1000000 / DATASET_SAMPLE_RATE_HZ);
+  header.sampleCount = numberOfSamples;
+  scanIndex += DATASET_SCANS_PER_PACKET;
+  poppedScans += DATASET_SCANS_PER_PACKET;
+  return EmgFrame::encode(header, samples, packet, packetSize, packetLength);
+}
@@ -14,6 +14,20 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "FullArm.h"
+#include "CoreTaskFactory.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#if defined(BIONIC_ARM_DUAL_CORE) && !defined(ARDUINO_ARCH_STM32)
+static constexpr size_t CORE_TASK_ARENA_BYTES = StaticArena::footprint<PlatformCoreTask>();
+#else
+static constexpr size_t CORE_TASK_ARENA_BYTES = 0;
+#endif
+
+static_assert(StaticArena::footprint<BionicArmApp>() + BIONIC_ARM_ARENA_BYTES +
+              CORE_TASK_ARENA_BYTES <= STATIC_ARENA_BYTES,
+              "Application does not fit the static arena, raise STATIC_ARENA_BYTES");
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Static members                                                                                */
@@ -29,7 +43,9 @@ BionicArmApp* BionicArmApp::instance = nullptr;
   ********************************************************************************************** */
 BionicArmApp& BionicArmApp::getInstance() {
   if (instance == nullptr) {
-    instance = new BionicArmApp();
+    // The constructor is private, so the arena only provides the memory
+    instance = new (StaticArena::allocate(sizeof(BionicArmApp),
+                                          alignof(BionicArmApp))) BionicArmApp();
   }
   return *instance;
 }
@@ -44,7 +60,8 @@ BionicArmApp::BionicArmApp() : App() {
   uint8_t rowPins[3] = {12,13,14};
   uint8_t colPins[3] = {15,16,17};
   
-  bionicArm = new BionicArm(emgPin, motorPins, rowPins, colPins);
+  bionicArm = StaticArena::create<BionicArm>(emgPin, motorPins, rowPins, colPins);
+  acquisitionCore = nullptr;
 }
 
 /**************************************************************************************************
@@ -52,7 +69,10 @@ BionicArmApp::BionicArmApp() : App() {
   * @return     Nothing
   ********************************************************************************************** */
 BionicArmApp::~BionicArmApp() {
-  delete bionicArm;
+  if (acquisitionCore != nullptr) {
+    StaticArena::destroy(acquisitionCore);
+  }
+  StaticArena::destroy(bionicArm);
   if (instance == this) {
     instance = nullptr;
   }
@@ -64,15 +84,63 @@ BionicArmApp::~BionicArmApp() {
 /**************************************************************************************************
   * @brief      Start application
   * @return     Nothing
+  * @details    When acquisition gets a core of its own, the scheduler here only runs the
+  *             motion, classification and telemetry tasks, so a blocked link never delays
+  *             sampling. Otherwise acquisition is the most urgent task of the schedule.
   ********************************************************************************************** */
 void BionicArmApp::onStart() {
   bionicArm->setup();
+  acquisitionTask = -1;
+  if (!startAcquisitionCore()) {
+    acquisitionTask = addTask("acquisition", ACQUISITION_PERIOD_US, ACQUISITION_PERIOD_US, 0);
+  }
+  motionTask = addTask("motion", MOTION_PERIOD_US, MOTION_PERIOD_US / 5, 1);
+  classificationTask = addTask("classification", CLASSIFICATION_PERIOD_US,
+                               CLASSIFICATION_PERIOD_US / 4, 2);
+  telemetryTask = addTask("telemetry", TELEMETRY_PERIOD_US, TELEMETRY_PERIOD_US, 3);
+}
+
+/**************************************************************************************************
+  * @brief      Run one release of a scheduled task
+  * @param      taskId Task being released
+  * @return     Nothing
+  ********************************************************************************************** */
+void BionicArmApp::onTask(uint8_t taskId) {
+  if (taskId == acquisitionTask) {
+    bionicArm->acquire();
+  } else if (taskId == motionTask) {
+    bionicArm->updateMotors();
+  } else if (taskId == classificationTask) {
+    bionicArm->classify();
+  } else if (taskId == telemetryTask) {
+    bionicArm->sendTelemetry();
+  }
+} 
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Move acquisition to ACQUISITION_CORE when built with -DBIONIC_ARM_DUAL_CORE
+  * @return     true if the acquisition task runs on its own core
+  * @details    Single core boards have no core task and keep acquisition in the schedule.
+  ********************************************************************************************** */
+bool BionicArmApp::startAcquisitionCore() {
+#ifdef BIONIC_ARM_DUAL_CORE
+  acquisitionCore = CoreTaskFactory::createCoreTask("acquisition", ACQUISITION_CORE,
+                                                    ACQUISITION_PRIORITY);
+  return acquisitionCore != nullptr &&
+         acquisitionCore->start(acquisitionStep, bionicArm, ACQUISITION_PERIOD_US);
+#else
+  return false;
+#endif
 }
 
 /**************************************************************************************************
-  * @brief      Main application loop
+  * @brief      Body of the acquisition core task
+  * @param      context The BionicArm
   * @return     Nothing
   ********************************************************************************************** */
-void BionicArmApp::onLoop() {
-  bionicArm->doGesture();
-} 
\ No newline at end of file
+void BionicArmApp::acquisitionStep(void* context) {
+  ((BionicArm*)context)->acquire();
+}
@@ -0,0 +1,258 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Replay.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host Replay Application Implementation
+ *
+ **************************************************************************************************
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "Replay.h"
+#include "EmgDataset.h"
+#include "EmgFrame.h"
+#include "HostAdc.h"
+#include "HostSerial.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+static_assert(StaticArena::footprint<BionicArmApp>() + BIONIC_ARM_ARENA_BYTES <=
+              STATIC_ARENA_BYTES,
+              "Application does not fit the static arena, raise STATIC_ARENA_BYTES");
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+BionicArmApp* BionicArmApp::instance = nullptr;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Get singleton instance
+  * @return     Reference to singleton instance
+  ********************************************************************************************** */
+BionicArmApp& BionicArmApp::getInstance() {
+  if (instance == nullptr) {
+    // The constructor is private, so the arena only provides the memory
+    instance = new (StaticArena::allocate(sizeof(BionicArmApp),
+                                          alignof(BionicArmApp))) BionicArmApp();
+  }
+  return *instance;
+}
+
+/**************************************************************************************************
+  * @brief      Constructor, same wiring as the FullArm application
+  * @return     Nothing
+  ********************************************************************************************** */
+BionicArmApp::BionicArmApp() : App() {
+  uint8_t emgPin = 34;
+  uint8_t motorPins[10] = {2,3,4,5,6,7,8,9,10,11};
+  uint8_t rowPins[3] = {12,13,14};
+  uint8_t colPins[3] = {15,16,17};
+
+  bionicArm = StaticArena::create<BionicArm>(emgPin, motorPins, rowPins, colPins);
+  path = getenv("REPLAY_FILE");
+  recordingRateHz = EMG_SAMPLE_RATE_HZ;
+  originUs = 0;
+  started = false;
+  finished = false;
+}
+
+/**************************************************************************************************
+  * @brief      Destructor
+  * @return     Nothing
+  ********************************************************************************************** */
+BionicArmApp::~BionicArmApp() {
+  StaticArena::destroy(bionicArm);
+  if (instance == this) {
+    instance = nullptr;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Protected methods                                                                             */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Load the recording and start the FullArm tasks on it
+  * @return     Nothing
+  * @details    On a load error the tasks still start and the first release stops the run.
+  ********************************************************************************************** */
+void BionicArmApp::onStart() {
+  Serial.begin(115200);
+  finished = !loadRecording();
+  HostAdc::setSource(replaySource, this);
+  HostSerial::attach(-1, open("/dev/null", O_WRONLY));
+  bionicArm->setup();
+  wallStart = std::chrono::steady_clock::now();
+  acquisitionTask = addTask("acquisition", ACQUISITION_PERIOD_US, ACQUISITION_PERIOD_US, 0);
+  motionTask = addTask("motion", MOTION_PERIOD_US, MOTION_PERIOD_US / 5, 1);
+  classificationTask = addTask("classification", CLASSIFICATION_PERIOD_US,
+                               CLASSIFICATION_PERIOD_US / 4, 2);
+  telemetryTask = addTask("telemetry", TELEMETRY_PERIOD_US, TELEMETRY_PERIOD_US, 3);
+}
+
+/**************************************************************************************************
+  * @brief      Run one release of a scheduled task, stop at the end of the recording
+  * @param      taskId Task being released
+  * @return     Nothing
+  ********************************************************************************************** */
+void BionicArmApp::onTask(uint8_t taskId) {
+  if (finished) {
+    if (!recording.empty()) {
+      report();
+    }
+    stop();
+  } else if (taskId == acquisitionTask) {
+    bionicArm->acquire();
+  } else if (taskId == motionTask) {
+    bionicArm->updateMotors();
+  } else if (taskId == classificationTask) {
+    if (bionicArm->classify()) {
+      recordDecision();
+    }
+  } else if (taskId == telemetryTask) {
+    bionicArm->sendTelemetry();
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Read REPLAY_FILE into ADC samples
+  * @return     true if the file holds at least one sample
+  * @details    Datasets are mapped and channel 0 of every segment is taken in file order.
+  *             Raw captures are decoded frame by frame, corrupt frames are skipped.
+  ********************************************************************************************** */
+bool BionicArmApp::loadRecording() {
+  if (path == nullptr) {
+    Serial.println("Replay: set REPLAY_FILE to a dataset or a capture");
+    return false;
+  }
+  if (EmgDatasetReader::isDataset(path)) {
+    EmgDatasetReader dataset;
+    if (!dataset.open(path)) {
+      Serial.printf("Replay: %s is not a complete dataset\n", path);
+      return false;
+    }
+    recordingRateHz = dataset.getSampleRateHz();
+    recording.reserve(dataset.getSampleCount());
+    for (uint64_t id = 0; id < dataset.getSegmentCount(); id++) {
+      EmgSegment segment;
+      if (!dataset.getSegment(id, segment)) {
+        break;
+      }
+      for (int16_t sample : segment.channels[0]) {
+        recording.push_back((uint16_t)(sample + EMG_ADC_MIDSCALE));
+      }
+    }
+  } else {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+      Serial.printf("Replay: cannot open %s\n", path);
+      return false;
+    }
+    EmgFrameReceiver receiver;
+    EmgFrameHeader header;
+    static uint16_t samples[EMG_FRAME_MAX_SAMPLES];
+    int byte;
+    while ((byte = fgetc(file)) != EOF) {
+      if (receiver.push((uint8_t)byte) &&
+          EmgFrame::decode(receiver.frame(), receiver.length(), header, samples,
+                           EMG_FRAME_MAX_SAMPLES) &&
+          EMG_FRAME_HAS_SAMPLES(header.type) && header.channels == 1) {
+        recording.insert(recording.end(), samples, samples + header.sampleCount);
+      }
+    }
+    fclose(file);
+  }
+  if (recording.empty() || recordingRateHz == 0) {
+    Serial.printf("Replay: no sample in %s\n", path);
+    return false;
+  }
+  if (recordingRateHz != EMG_SAMPLE_RATE_HZ) {
+    Serial.printf("Replay: recorded at %u Hz, resampled to %u Hz\n", (unsigned)recordingRateHz,
+                  (unsigned)EMG_SAMPLE_RATE_HZ);
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Add a classifier decision to the timeline when the gesture changes
+  * @return     Nothing
+  ********************************************************************************************** */
+void BionicArmApp::recordDecision() {
+  ReplayDecision decision;
+  if (!bionicArm->getLastGesture(decision.gestureId, decision.rms)) {
+    return;
+  }
+  if (!timeline.empty() && timeline.back().gestureId == decision.gestureId) {
+    return;
+  }
+  decision.timeUs = micros() - originUs;
+  timeline.push_back(decision);
+}
+
+/**************************************************************************************************
+  * @brief      Print throughput, stage latencies and the gesture timeline
+  * @return     Nothing
+  ********************************************************************************************** */
+void BionicArmApp::report() {
+  double wallSeconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+  double recordedSeconds = (double)recording.size() / recordingRateHz;
+  Serial.printf("Replay %s: %zu samples, %.1f s recorded, %.3f s wall\n", path,
+                recording.size(), recordedSeconds, wallSeconds);
+  Serial.printf("Throughput: %.0f samples/s, %.0fx real time, CPU load %.1f %% of the target "
+                "schedule\n", recording.size() / wallSeconds, recordedSeconds / wallSeconds,
+                getCpuLoad() / 10.0);
+
+  const LatencyTrace& trace = bionicArm->getTrace();
+  Serial.printf("%-12s %10s %10s %10s %10s\n", "stage", "count", "p50 ns", "p99 ns", "max ns");
+  for (uint8_t stage = 0; stage < trace.getStageCount(); stage++) {
+    LatencyReport latency;
+    trace.getReport(stage, latency);
+    Serial.printf("%-12s %10lu %10lu %10lu %10lu\n", latency.name, (unsigned long)latency.count,
+                  (unsigned long)latency.p50Ns, (unsigned long)latency.p99Ns,
+                  (unsigned long)latency.maxNs);
+  }
+
+  Serial.printf("Gesture timeline (%zu changes):\n", timeline.size());
+  for (const ReplayDecision& decision : timeline) {
+    Serial.printf("%10.3f s  gesture %u  rms %u\n", decision.timeUs / 1e6,
+                  (unsigned)decision.gestureId, (unsigned)decision.rms);
+  }
+}
+
+/**************************************************************************************************
+  * @brief      HostAdc source returning the recording
+  * @param      pin Unused, every pin sees the recording
+  * @param      timeUs Conversion time
+  * @param      context The application
+  * @return     Recorded sample nearest to the conversion time, mid-scale after the end
+  * @details    Time zero is the first conversion. Reaching the end marks the replay finished.
+  ********************************************************************************************** */
+uint16_t BionicArmApp::replaySource(uint8_t pin, uint64_t timeUs, void* context) {
+  (void)pin;
+  BionicArmApp* app = (BionicArmApp*)context;
+  if (!app->started) {
+    app->originUs = timeUs;
+    app->started = true;
+  }
+  uint64_t index = ((timeUs - app->originUs) * app->recordingRateHz + 500000) / 1000000;
+  if (index >= app->recording.size()) {
+    app->finished = true;
+    return EMG_ADC_MIDSCALE;
+  }
+  return app->recording[index];
+}
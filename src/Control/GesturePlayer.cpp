@@ -0,0 +1,203 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : GesturePlayer.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Table-driven gesture trajectories and keyframe interpolator Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "GesturePlayer.h"
+#include "GestureTable.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+static_assert(sizeof(defaultGestureTable) / sizeof(defaultGestureTable[0]) <= GESTURE_TABLE_SIZE,
+              "Default gesture table does not fit GESTURE_TABLE_SIZE");
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor, loads the default gesture table
+  * @return     Nothing
+  ********************************************************************************************** */
+GesturePlayer::GesturePlayer() {
+  const size_t defaults = sizeof(defaultGestureTable) / sizeof(defaultGestureTable[0]);
+  for (size_t i = 0; i < GESTURE_TABLE_SIZE; i++) {
+    this->table[i] = i < defaults ? defaultGestureTable[i] : Gesture{};
+  }
+  for (uint8_t f = 0; f < GESTURE_FINGERS; f++) {
+    this->startSpeeds[f] = 0;
+    this->speeds[f] = 0;
+  }
+  this->startMs = 0;
+  this->currentGesture = GESTURE_TABLE_SIZE;
+  this->running = false;
+  this->started = false;
+}
+
+/**************************************************************************************************
+  * @brief      Replace a gesture of the table
+  * @param      gestureId Table entry
+  * @param      gesture New trajectories, copied
+  * @return     true if the gesture was loaded
+  * @details    Loading the gesture being played stops it, the fingers hold their current speed
+  *             until the next start ramps them into the new trajectories.
+  ********************************************************************************************** */
+bool GesturePlayer::load(uint8_t gestureId, const Gesture& gesture) {
+  if (gestureId >= GESTURE_TABLE_SIZE) {
+    return false;
+  }
+  for (uint8_t f = 0; f < GESTURE_FINGERS; f++) {
+    const FingerTrajectory& trajectory = gesture.fingers[f];
+    if (trajectory.count > GESTURE_MAX_KEYFRAMES) {
+      return false;
+    }
+    for (uint8_t k = 0; k < trajectory.count; k++) {
+      if (trajectory.keyframes[k].speed > GESTURE_SPEED_MAX ||
+          trajectory.keyframes[k].speed < -GESTURE_SPEED_MAX ||
+          (k > 0 && trajectory.keyframes[k].timeMs < trajectory.keyframes[k - 1].timeMs)) {
+        return false;
+      }
+    }
+  }
+  this->table[gestureId] = gesture;
+  if (gestureId == this->currentGesture) {
+    this->currentGesture = GESTURE_TABLE_SIZE;
+    this->running = false;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Start a gesture
+  * @param      gestureId Table entry
+  * @param      nowMs Current time
+  * @return     true if the gesture is playing or already reached its final pose
+  * @details    Starting the current gesture again does not restart it, so a classifier can
+  *             confirm the same gesture on every window.
+  ********************************************************************************************** */
+bool GesturePlayer::start(uint8_t gestureId, uint32_t nowMs) {
+  if (gestureId >= GESTURE_TABLE_SIZE) {
+    return false;
+  }
+  if (this->started && gestureId == this->currentGesture) {
+    return true;
+  }
+  for (uint8_t f = 0; f < GESTURE_FINGERS; f++) {
+    this->startSpeeds[f] = this->speeds[f];
+  }
+  this->startMs = nowMs;
+  this->currentGesture = gestureId;
+  this->running = true;
+  this->started = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Advance the trajectories, call once per control tick
+  * @param      nowMs Current time
+  * @param[out] speeds GESTURE_FINGERS motor speeds to apply
+  * @return     true if the speeds may have changed since the previous call
+  ********************************************************************************************** */
+bool GesturePlayer::update(uint32_t nowMs, int16_t* speeds) {
+  if (!this->running) {
+    for (uint8_t f = 0; f < GESTURE_FINGERS; f++) {
+      speeds[f] = this->speeds[f];
+    }
+    return false;
+  }
+  uint32_t elapsedMs = nowMs - this->startMs;
+  bool finished = true;
+  for (uint8_t f = 0; f < GESTURE_FINGERS; f++) {
+    bool fingerFinished;
+    this->speeds[f] = interpolate(f, elapsedMs, fingerFinished);
+    speeds[f] = this->speeds[f];
+    finished &= fingerFinished;
+  }
+  this->running = !finished;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Check if a gesture is still moving
+  * @return     true until every finger passed its last keyframe
+  ********************************************************************************************** */
+bool GesturePlayer::active() const {
+  return this->running;
+}
+
+/**************************************************************************************************
+  * @brief      Gesture being played or held
+  * @return     Gesture id, GESTURE_TABLE_SIZE if none
+  ********************************************************************************************** */
+uint8_t GesturePlayer::current() const {
+  return this->currentGesture;
+}
+
+/**************************************************************************************************
+  * @brief      Check if a table entry holds a gesture
+  * @param      gestureId Table entry
+  * @return     true if at least one finger has a trajectory
+  ********************************************************************************************** */
+bool GesturePlayer::defined(uint8_t gestureId) const {
+  if (gestureId >= GESTURE_TABLE_SIZE) {
+    return false;
+  }
+  for (uint8_t f = 0; f < GESTURE_FINGERS; f++) {
+    if (this->table[gestureId].fingers[f].count > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Speed of one finger of the current gesture
+  * @param      finger Finger index
+  * @param      elapsedMs Time since the gesture start
+  * @param[out] finished true once the last keyframe is reached
+  * @return     Interpolated speed
+  * @details    A finger without a trajectory ramps to 0 over GESTURE_STOP_RAMP_MS, as if its
+  *             trajectory were a single keyframe stopping it.
+  ********************************************************************************************** */
+int16_t GesturePlayer::interpolate(uint8_t finger, uint32_t elapsedMs, bool& finished) const {
+  const FingerTrajectory& trajectory = this->table[this->currentGesture].fingers[finger];
+  int32_t fromMs = 0;
+  int32_t fromSpeed = this->startSpeeds[finger];
+  if (trajectory.count == 0) {
+    finished = elapsedMs >= GESTURE_STOP_RAMP_MS;
+    return finished ? 0 : (int16_t)(fromSpeed - fromSpeed * (int32_t)elapsedMs /
+                                                GESTURE_STOP_RAMP_MS);
+  }
+  for (uint8_t k = 0; k < trajectory.count; k++) {
+    const GestureKeyframe& to = trajectory.keyframes[k];
+    if (elapsedMs < to.timeMs) {
+      finished = false;
+      return (int16_t)(fromSpeed + (to.speed - fromSpeed) * ((int32_t)elapsedMs - fromMs) /
+                                   ((int32_t)to.timeMs - fromMs));
+    }
+    fromMs = to.timeMs;
+    fromSpeed = to.speed;
+  }
+  finished = true;
+  return (int16_t)fromSpeed;
+}
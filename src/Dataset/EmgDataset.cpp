@@ -0,0 +1,416 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgDataset.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Columnar EMG dataset file, streaming writer and memory-mapped reader Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "EmgDataset.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "Dataset files are little endian and mapped without conversion");
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Helpers                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+static size_t alignUp(size_t size) {
+  return (size + EMG_DATASET_ALIGN - 1) & ~(size_t)(EMG_DATASET_ALIGN - 1);
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Writer                                                                                        */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor
+  * @return     Nothing
+  ********************************************************************************************** */
+EmgDatasetWriter::EmgDatasetWriter() {
+  this->file = nullptr;
+  this->channels = 0;
+  this->sampleRateHz = 0;
+  this->offset = 0;
+  this->sampleCount = 0;
+  memset(&this->current, 0, sizeof(this->current));
+}
+
+/**************************************************************************************************
+  * @brief      Destructor, completes the file if still open
+  * @return     Nothing
+  ********************************************************************************************** */
+EmgDatasetWriter::~EmgDatasetWriter() {
+  close();
+}
+
+/**************************************************************************************************
+  * @brief      Create a dataset and write its header
+  * @param      path File to create, truncated if it exists
+  * @param      channels Samples per scan, 1 to EMG_DATASET_MAX_CHANNELS
+  * @param      sampleRateHz Scan rate, gives the sample timestamps inside a block
+  * @return     true if the file was created
+  ********************************************************************************************** */
+bool EmgDatasetWriter::open(const char* path, uint16_t channels, uint32_t sampleRateHz) {
+  if (this->file != nullptr || channels == 0 || channels > EMG_DATASET_MAX_CHANNELS ||
+      sampleRateHz == 0) {
+    return false;
+  }
+  this->file = fopen(path, "wb");
+  if (this->file == nullptr) {
+    return false;
+  }
+  this->channels = channels;
+  this->sampleRateHz = sampleRateHz;
+  this->offset = 0;
+  this->sampleCount = 0;
+  this->index.clear();
+  this->current.sampleCount = 0;
+  this->columns.assign((size_t)channels * EMG_DATASET_SEGMENT_SAMPLES, 0);
+  this->timestamps.assign(EMG_DATASET_SEGMENT_SAMPLES, 0);
+  this->labels.assign(EMG_DATASET_SEGMENT_SAMPLES, 0);
+
+  EmgDatasetHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, EMG_DATASET_MAGIC, sizeof(header.magic));
+  header.version = EMG_DATASET_VERSION;
+  header.channels = channels;
+  header.sampleRateHz = sampleRateHz;
+  return write(&header, sizeof(header));
+}
+
+/**************************************************************************************************
+  * @brief      Add a block of samples
+  * @param      label Gesture id of the block
+  * @param      session Recording session
+  * @param      subject Person wearing the electrodes
+  * @param      timestampUs Time of the first scan
+  * @param      interleaved Scans of channels samples, zero-centred
+  * @param      count Number of samples, a multiple of the channel count
+  * @return     true if the samples were buffered or written
+  ********************************************************************************************** */
+bool EmgDatasetWriter::append(uint8_t label, uint32_t session, uint32_t subject,
+                              uint64_t timestampUs, const int16_t* interleaved, size_t count) {
+  if (this->file == nullptr || count % this->channels != 0) {
+    return false;
+  }
+  size_t scans = count / this->channels;
+  for (size_t s = 0; s < scans; s++) {
+    uint64_t sampleUs = timestampUs + (uint64_t)s * 1000000 / this->sampleRateHz;
+    EmgDatasetIndexEntry& segment = this->current;
+    bool sameSegment = segment.sampleCount > 0 && segment.label == label &&
+                       segment.session == session && segment.subject == subject &&
+                       segment.sampleCount < EMG_DATASET_SEGMENT_SAMPLES &&
+                       sampleUs >= segment.startUs && sampleUs - segment.startUs <= UINT32_MAX;
+    if (!sameSegment) {
+      if (!flush()) {
+        return false;
+      }
+      segment.label = label;
+      segment.session = session;
+      segment.subject = subject;
+      segment.startUs = sampleUs;
+    }
+    uint32_t n = segment.sampleCount++;
+    for (uint16_t c = 0; c < this->channels; c++) {
+      this->columns[(size_t)c * EMG_DATASET_SEGMENT_SAMPLES + n] = interleaved[s * this->channels + c];
+    }
+    this->timestamps[n] = (uint32_t)(sampleUs - segment.startUs);
+    this->labels[n] = label;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Write the last segment, the index and the trailer, then close the file
+  * @return     true if the dataset is complete
+  ********************************************************************************************** */
+bool EmgDatasetWriter::close() {
+  if (this->file == nullptr) {
+    return false;
+  }
+  bool success = flush();
+  EmgDatasetTrailer trailer;
+  memset(&trailer, 0, sizeof(trailer));
+  memcpy(trailer.magic, EMG_DATASET_TRAILER_MAGIC, sizeof(trailer.magic));
+  trailer.indexOffset = this->offset;
+  trailer.segmentCount = this->index.size();
+  trailer.sampleCount = this->sampleCount;
+  success &= this->index.empty() ||
+             write(this->index.data(), this->index.size() * sizeof(EmgDatasetIndexEntry));
+  success &= pad() && write(&trailer, sizeof(trailer));
+  success &= fclose(this->file) == 0;
+  this->file = nullptr;
+  return success;
+}
+
+/**************************************************************************************************
+  * @brief      Number of segments written so far
+  * @return     Segment count
+  ********************************************************************************************** */
+uint64_t EmgDatasetWriter::getSegmentCount() const {
+  return this->index.size();
+}
+
+/**************************************************************************************************
+  * @brief      Write the buffered segment as columns and add it to the index
+  * @return     true if nothing was buffered or the segment was written
+  ********************************************************************************************** */
+bool EmgDatasetWriter::flush() {
+  uint32_t n = this->current.sampleCount;
+  if (n == 0) {
+    return true;
+  }
+  this->current.offset = this->offset;
+  bool success = true;
+  for (uint16_t c = 0; c < this->channels; c++) {
+    success &= write(&this->columns[(size_t)c * EMG_DATASET_SEGMENT_SAMPLES],
+                     n * sizeof(int16_t)) && pad();
+  }
+  success &= write(this->timestamps.data(), n * sizeof(uint32_t)) && pad();
+  success &= write(this->labels.data(), n * sizeof(uint8_t)) && pad();
+  this->index.push_back(this->current);
+  this->sampleCount += n;
+  this->current.sampleCount = 0;
+  return success;
+}
+
+/**************************************************************************************************
+  * @brief      Append raw bytes
+  * @return     true if every byte was written
+  ********************************************************************************************** */
+bool EmgDatasetWriter::write(const void* data, size_t size) {
+  size_t written = fwrite(data, 1, size, this->file);
+  this->offset += written;
+  return written == size;
+}
+
+/**************************************************************************************************
+  * @brief      Pad with zeros up to the next EMG_DATASET_ALIGN boundary
+  * @return     true if the padding was written
+  ********************************************************************************************** */
+bool EmgDatasetWriter::pad() {
+  static const uint8_t zeros[EMG_DATASET_ALIGN] = {};
+  return write(zeros, alignUp(this->offset) - this->offset);
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Reader                                                                                        */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor
+  * @return     Nothing
+  ********************************************************************************************** */
+EmgDatasetReader::EmgDatasetReader() {
+  this->mapping = nullptr;
+  this->mappingSize = 0;
+  this->header = nullptr;
+  this->trailer = nullptr;
+  this->index = nullptr;
+}
+
+/**************************************************************************************************
+  * @brief      Destructor, unmaps the file
+  * @return     Nothing
+  ********************************************************************************************** */
+EmgDatasetReader::~EmgDatasetReader() {
+  close();
+}
+
+/**************************************************************************************************
+  * @brief      Map a dataset and check its header, trailer and index
+  * @param      path Dataset file
+  * @return     true if the file is a complete dataset
+  ********************************************************************************************** */
+bool EmgDatasetReader::open(const char* path) {
+  close();
+  int fd = ::open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat status;
+  bool mapped = false;
+  if (fstat(fd, &status) == 0 &&
+      (size_t)status.st_size >= sizeof(EmgDatasetHeader) + sizeof(EmgDatasetTrailer)) {
+    void* mapping = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping != MAP_FAILED) {
+      this->mapping = (const uint8_t*)mapping;
+      this->mappingSize = (size_t)status.st_size;
+      mapped = true;
+    }
+  }
+  ::close(fd);   // The mapping keeps the file open
+  if (!mapped) {
+    return false;
+  }
+
+  this->header = (const EmgDatasetHeader*)this->mapping;
+  this->trailer = (const EmgDatasetTrailer*)(this->mapping + this->mappingSize -
+                                              sizeof(EmgDatasetTrailer));
+  bool valid = memcmp(this->header->magic, EMG_DATASET_MAGIC, sizeof(this->header->magic)) == 0 &&
+               this->header->version == EMG_DATASET_VERSION && this->header->channels > 0 &&
+               this->header->channels <= EMG_DATASET_MAX_CHANNELS &&
+               memcmp(this->trailer->magic, EMG_DATASET_TRAILER_MAGIC,
+                      sizeof(this->trailer->magic)) == 0 &&
+               this->trailer->indexOffset <= this->mappingSize - sizeof(EmgDatasetTrailer) &&
+               this->trailer->segmentCount <=
+                 (this->mappingSize - sizeof(EmgDatasetTrailer) - this->trailer->indexOffset) /
+                 sizeof(EmgDatasetIndexEntry);
+  if (!valid) {
+    close();
+    return false;
+  }
+  this->index = (const EmgDatasetIndexEntry*)(this->mapping + this->trailer->indexOffset);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Unmap the file, every span becomes invalid
+  * @return     Nothing
+  ********************************************************************************************** */
+void EmgDatasetReader::close() {
+  if (this->mapping != nullptr) {
+    munmap((void*)this->mapping, this->mappingSize);
+  }
+  this->mapping = nullptr;
+  this->mappingSize = 0;
+  this->header = nullptr;
+  this->trailer = nullptr;
+  this->index = nullptr;
+}
+
+/**************************************************************************************************
+  * @brief      Samples per scan
+  * @return     Channel count, 0 if no file is open
+  ********************************************************************************************** */
+uint16_t EmgDatasetReader::getChannels() const {
+  return this->header != nullptr ? this->header->channels : 0;
+}
+
+/**************************************************************************************************
+  * @brief      Scan rate of the recording
+  * @return     Rate in Hz, 0 if no file is open
+  ********************************************************************************************** */
+uint32_t EmgDatasetReader::getSampleRateHz() const {
+  return this->header != nullptr ? this->header->sampleRateHz : 0;
+}
+
+/**************************************************************************************************
+  * @brief      Number of segments
+  * @return     Segment count, 0 if no file is open
+  ********************************************************************************************** */
+uint64_t EmgDatasetReader::getSegmentCount() const {
+  return this->trailer != nullptr ? this->trailer->segmentCount : 0;
+}
+
+/**************************************************************************************************
+  * @brief      Number of scans in the whole file
+  * @return     Samples per channel, 0 if no file is open
+  ********************************************************************************************** */
+uint64_t EmgDatasetReader::getSampleCount() const {
+  return this->trailer != nullptr ? this->trailer->sampleCount : 0;
+}
+
+/**************************************************************************************************
+  * @brief      Spans over the columns of one segment
+  * @param      segmentId Segment index
+  * @param[out] segment Keys and columns, pointing into the mapping
+  * @return     true if the segment lies inside the file
+  ********************************************************************************************** */
+bool EmgDatasetReader::getSegment(uint64_t segmentId, EmgSegment& segment) const {
+  if (segmentId >= getSegmentCount()) {
+    return false;
+  }
+  const EmgDatasetIndexEntry& entry = this->index[segmentId];
+  uint16_t channels = this->header->channels;
+  if (entry.sampleCount > EMG_DATASET_SEGMENT_SAMPLES || entry.offset % EMG_DATASET_ALIGN != 0 ||
+      entry.offset > this->trailer->indexOffset ||
+      segmentBytes(channels, entry.sampleCount) > this->trailer->indexOffset - entry.offset) {
+    return false;
+  }
+  size_t n = entry.sampleCount;
+  const uint8_t* column = this->mapping + entry.offset;
+  segment.label = entry.label;
+  segment.session = entry.session;
+  segment.subject = entry.subject;
+  segment.startUs = entry.startUs;
+  for (uint16_t c = 0; c < EMG_DATASET_MAX_CHANNELS; c++) {
+    segment.channels[c] = { c < channels ? (const int16_t*)column : nullptr, c < channels ? n : 0 };
+    column += c < channels ? alignUp(n * sizeof(int16_t)) : 0;
+  }
+  segment.timestamps = { (const uint32_t*)column, n };
+  column += alignUp(n * sizeof(uint32_t));
+  segment.labels = { column, n };
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Find the segments matching a label, session and subject
+  * @param      label Gesture id, or EMG_DATASET_ANY
+  * @param      session Session, or EMG_DATASET_ANY
+  * @param      subject Subject, or EMG_DATASET_ANY
+  * @param[out] segmentIds Matching segments in file order, replaced
+  * @return     Number of matching segments
+  * @details    Scans the index only, the sample columns are not touched.
+  ********************************************************************************************** */
+size_t EmgDatasetReader::select(uint32_t label, uint32_t session, uint32_t subject,
+                                std::vector<uint64_t>& segmentIds) const {
+  segmentIds.clear();
+  for (uint64_t i = 0; i < getSegmentCount(); i++) {
+    const EmgDatasetIndexEntry& entry = this->index[i];
+    if ((label == EMG_DATASET_ANY || entry.label == label) &&
+        (session == EMG_DATASET_ANY || entry.session == session) &&
+        (subject == EMG_DATASET_ANY || entry.subject == subject)) {
+      segmentIds.push_back(i);
+    }
+  }
+  return segmentIds.size();
+}
+
+/**************************************************************************************************
+  * @brief      Check the magic of a file without mapping it
+  * @param      path File to check
+  * @return     true if the file starts like a dataset
+  ********************************************************************************************** */
+bool EmgDatasetReader::isDataset(const char* path) {
+  char magic[8];
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool match = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+               memcmp(magic, EMG_DATASET_MAGIC, sizeof(magic)) == 0;
+  fclose(file);
+  return match;
+}
+
+/**************************************************************************************************
+  * @brief      Size of a segment on disk
+  * @param      channels Channel count
+  * @param      sampleCount Samples per channel
+  * @return     Size in bytes, padding included
+  ********************************************************************************************** */
+size_t EmgDatasetReader::segmentBytes(uint16_t channels, uint32_t sampleCount) {
+  return channels * alignUp(sampleCount * sizeof(int16_t)) +
+         alignUp(sampleCount * sizeof(uint32_t)) + alignUp(sampleCount * sizeof(uint8_t));
+}
@@ -0,0 +1,189 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgFeatures.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Sliding-window EMG feature extractor Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "EmgFeatures.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for the feature extractor
+  * @param      windowLength Samples per window, clamped to [3, EMG_FEATURES_MAX_WINDOW]
+  * @param      hop Samples between two feature vectors, window overlap is windowLength - hop
+  * @param      threshold Minimum amplitude step counted by ZC and SSC
+  * @return     Nothing
+  ********************************************************************************************** */
+EmgFeatures::EmgFeatures(uint16_t windowLength, uint16_t hop, uint16_t threshold) {
+  if (windowLength < 3) {
+    windowLength = 3;
+  } else if (windowLength > EMG_FEATURES_MAX_WINDOW) {
+    windowLength = EMG_FEATURES_MAX_WINDOW;
+  }
+  this->windowLength = windowLength;
+  this->hop = hop > 0 ? hop : 1;
+  this->threshold = threshold;
+  reset();
+}
+
+/**************************************************************************************************
+  * @brief      Forget every sample, the next vector comes after a full window
+  * @return     Nothing
+  ********************************************************************************************** */
+void EmgFeatures::reset() {
+  this->index = 0;
+  this->filled = 0;
+  this->hopCount = 0;
+  this->sumSquares = 0;
+  this->sumAbs = 0;
+  this->waveformLength = 0;
+  this->zeroCrossings = 0;
+  this->slopeChanges = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Add one sample
+  * @param      sample Zero-centred sample
+  * @param      features Receives the window features when a hop completes
+  * @return     true if features was updated
+  * @details    The window holds the last windowLength samples, so windowLength - 1 differences
+  *             (WL, ZC) and windowLength - 2 triples (SSC). Each update adds the terms ending
+  *             at the new sample and removes the terms starting at the sample leaving.
+  ********************************************************************************************** */
+bool EmgFeatures::push(int16_t sample, EmgFeatureVector& features) {
+  uint32_t n = this->index;
+  this->history[n & (EMG_FEATURES_HISTORY - 1)] = sample;
+  int32_t magnitude = sample < 0 ? -sample : sample;
+
+  // Terms ending at the newest sample
+  this->sumSquares += (uint32_t)(magnitude * magnitude);
+  this->sumAbs += magnitude;
+  if (this->filled >= 1) {
+    int16_t previous = at(n - 1);
+    int32_t step = (int32_t)sample - previous;
+    this->waveformLength += step < 0 ? -step : step;
+    this->zeroCrossings += isZeroCrossing(previous, sample);
+    if (this->filled >= 2) {
+      this->slopeChanges += isSlopeChange(at(n - 2), previous, sample);
+    }
+  }
+
+  // Terms starting at the sample leaving the window
+  if (this->filled == this->windowLength) {
+    uint32_t o = n - this->windowLength;
+    int16_t oldest = at(o);
+    int16_t second = at(o + 1);
+    int32_t oldMagnitude = oldest < 0 ? -oldest : oldest;
+    int32_t step = (int32_t)second - oldest;
+    this->sumSquares -= (uint32_t)(oldMagnitude * oldMagnitude);
+    this->sumAbs -= oldMagnitude;
+    this->waveformLength -= step < 0 ? -step : step;
+    this->zeroCrossings -= isZeroCrossing(oldest, second);
+    this->slopeChanges -= isSlopeChange(oldest, second, at(o + 2));
+  }
+
+  this->index = n + 1;
+  if (this->filled < this->windowLength) {
+    if (++this->filled < this->windowLength) {
+      return false;
+    }
+  } else if (++this->hopCount < this->hop) {
+    return false;
+  }
+  this->hopCount = 0;
+  output(features);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Add a block of samples
+  * @param      samples Zero-centred samples
+  * @param      count Number of samples
+  * @param      features Receives one vector per completed hop
+  * @param      maxFeatures Capacity of features, extra vectors are dropped
+  * @return     Number of vectors written
+  ********************************************************************************************** */
+size_t EmgFeatures::process(const int16_t* samples, size_t count,
+                            EmgFeatureVector* features, size_t maxFeatures) {
+  size_t produced = 0;
+  EmgFeatureVector vector;
+  for (size_t i = 0; i < count; i++) {
+    if (push(samples[i], vector) && produced < maxFeatures) {
+      features[produced++] = vector;
+    }
+  }
+  return produced;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+int16_t EmgFeatures::at(uint32_t index) const {
+  return this->history[index & (EMG_FEATURES_HISTORY - 1)];
+}
+
+bool EmgFeatures::isZeroCrossing(int16_t previous, int16_t current) const {
+  int32_t step = (int32_t)current - previous;
+  return ((previous < 0) != (current < 0)) && (step >= this->threshold || -step >= this->threshold);
+}
+
+bool EmgFeatures::isSlopeChange(int16_t previous, int16_t current, int16_t next) const {
+  int32_t rising = (int32_t)current - previous;
+  int32_t falling = (int32_t)current - next;
+  return ((rising > 0 && falling > 0) || (rising < 0 && falling < 0)) &&
+         (rising >= this->threshold || -rising >= this->threshold ||
+          falling >= this->threshold || -falling >= this->threshold);
+}
+
+/**************************************************************************************************
+  * @brief      Turn the running sums into a feature vector
+  * @return     Nothing
+  ********************************************************************************************** */
+void EmgFeatures::output(EmgFeatureVector& features) const {
+  features.rms = (uint16_t)isqrt(this->sumSquares / this->windowLength);
+  features.mav = (uint16_t)(this->sumAbs / this->windowLength);
+  features.wl = this->waveformLength;
+  features.zc = this->zeroCrossings;
+  features.ssc = this->slopeChanges;
+}
+
+/**************************************************************************************************
+  * @brief      Integer square root, bit by bit
+  * @param      value Input
+  * @return     floor(sqrt(value))
+  ********************************************************************************************** */
+uint32_t EmgFeatures::isqrt(uint64_t value) {
+  uint64_t result = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+  while (bit > value) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (value >= result + bit) {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint32_t)result;
+}
@@ -0,0 +1,128 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : GestureClassifier.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Quantized gesture classifier Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "GestureClassifier.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for the gesture classifier
+  * @param      model Model parameters, must outlive the classifier (normally a const global)
+  * @return     Nothing
+  ********************************************************************************************** */
+GestureClassifier::GestureClassifier(const GestureModel& model) : model(model) {
+}
+
+/**************************************************************************************************
+  * @brief      Check the model dimensions
+  * @return     true if the model can be evaluated
+  ********************************************************************************************** */
+bool GestureClassifier::valid() const {
+  return (this->model.classes > 0 && this->model.classes <= GESTURE_MAX_CLASSES &&
+          this->model.hidden <= GESTURE_MAX_HIDDEN);
+}
+
+/**************************************************************************************************
+  * @brief      Classify one feature window
+  * @param      features Feature vector of the window
+  * @param[out] gestureId Gesture with the highest score, lowest id on ties
+  * @return     true if a gesture was selected
+  * @details    Worst case is one model evaluation: classes x (hidden or 5) + hidden x 5 MACs.
+  ********************************************************************************************** */
+bool GestureClassifier::classify(const EmgFeatureVector& features, uint8_t& gestureId) const {
+  if (!valid()) {
+    return false;
+  }
+
+  int8_t inputs[EMG_FEATURES_COUNT];
+  quantize(features, inputs);
+
+  // Hidden layer, skipped by LDA models
+  int8_t hiddenOutputs[GESTURE_MAX_HIDDEN];
+  const int8_t* layerInputs = inputs;
+  uint8_t layerSize = EMG_FEATURES_COUNT;
+  if (this->model.hidden > 0) {
+    for (uint8_t j = 0; j < this->model.hidden; j++) {
+      int32_t acc = dot(this->model.hiddenWeights[j], inputs, EMG_FEATURES_COUNT) +
+                    this->model.hiddenBias[j];
+      hiddenOutputs[j] = clampInt8(acc >> this->model.hiddenShift, 0);
+    }
+    layerInputs = hiddenOutputs;
+    layerSize = this->model.hidden;
+  }
+
+  // Output layer and argmax
+  int32_t best = 0;
+  uint8_t bestClass = 0;
+  for (uint8_t k = 0; k < this->model.classes; k++) {
+    int32_t score = dot(this->model.outputWeights[k], layerInputs, layerSize) +
+                    this->model.outputBias[k];
+    if (k == 0 || score > best) {
+      best = score;
+      bestClass = k;
+    }
+  }
+  gestureId = bestClass;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Convert a feature vector to the int8 model inputs
+  * @param      features Feature vector
+  * @param[out] inputs EMG_FEATURES_COUNT quantized inputs
+  * @return     Nothing
+  ********************************************************************************************** */
+void GestureClassifier::quantize(const EmgFeatureVector& features, int8_t* inputs) const {
+  const int32_t raw[EMG_FEATURES_COUNT] = {
+    (int32_t)features.rms, (int32_t)features.mav,
+    (int32_t)(features.wl > INT32_MAX ? INT32_MAX : features.wl),
+    (int32_t)features.zc, (int32_t)features.ssc
+  };
+  for (uint8_t f = 0; f < EMG_FEATURES_COUNT; f++) {
+    int64_t centred = (int64_t)raw[f] - this->model.featureOffset[f];
+    inputs[f] = clampInt8((int32_t)(centred >> this->model.featureShift[f]), -128);
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Dot product of int8 vectors
+  * @return     Sum of products
+  ********************************************************************************************** */
+int32_t GestureClassifier::dot(const int8_t* weights, const int8_t* inputs, uint8_t count) {
+  int32_t acc = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    acc += (int16_t)weights[i] * (int16_t)inputs[i];
+  }
+  return acc;
+}
+
+/**************************************************************************************************
+  * @brief      Saturate to [low, 127]
+  * @return     Saturated value
+  ********************************************************************************************** */
+int8_t GestureClassifier::clampInt8(int32_t value, int32_t low) {
+  return (int8_t)(value < low ? low : (value > INT8_MAX ? INT8_MAX : value));
+}
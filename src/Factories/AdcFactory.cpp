@@ -22,7 +22,12 @@
 /*-----------------------------------------------------------------------------------------------*/
 #include "AdcFactory.h"
 #include "Stm32Adc.h"
+#include "Stm32AdcScan.h"
 #include "Esp32Adc.h"
+#include "Esp32AdcScan.h"
+#include "HostAdc.h"
+#include "HostAdcScan.h"
+#include "StaticArena.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -33,10 +38,30 @@
   ********************************************************************************************** */
 IAdc* AdcFactory::createAdc(uint8_t pin) {
   #ifdef ARDUINO_ARCH_STM32
-    return new Stm32Adc(pin);
+    return StaticArena::create<Stm32Adc>(pin);
   #elif defined(ARDUINO_ARCH_ESP32)
-    return new Esp32Adc(pin);
+    return StaticArena::create<Esp32Adc>(pin);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostAdc>(pin);
   #else
     return nullptr;
   #endif
-} 
\ No newline at end of file
+}
+
+/**************************************************************************************************
+  * @brief      Create a multi-channel ADC scan based on architecture
+  * @param      pins ADC pins in scan order
+  * @param      count Number of pins, at most ADC_SCAN_MAX_CHANNELS
+  * @return     ADC scan instance pointer
+  ********************************************************************************************** */
+IAdcScan* AdcFactory::createAdcScan(const uint8_t* pins, uint8_t count) {
+  #ifdef ARDUINO_ARCH_STM32
+    return StaticArena::create<Stm32AdcScan>(pins, count);
+  #elif defined(ARDUINO_ARCH_ESP32)
+    return StaticArena::create<Esp32AdcScan>(pins, count);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostAdcScan>(pins, count);
+  #else
+    return nullptr;
+  #endif
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : CoreTaskFactory.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Core task Factory Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "CoreTaskFactory.h"
+#include "Esp32CoreTask.h"
+#include "HostCoreTask.h"
+#include "StaticArena.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Create core task instance based on architecture
+  * @param      name Task name, shown by the RTOS or the debugger
+  * @param      core CPU core the task is pinned to
+  * @param      priority RTOS priority, higher is more urgent
+  * @return     Core task instance pointer, nullptr on single core boards (STM32)
+  ********************************************************************************************** */
+ICoreTask* CoreTaskFactory::createCoreTask(const char* name, uint8_t core, uint8_t priority) {
+  #ifdef ARDUINO_ARCH_STM32
+    return nullptr;
+  #elif defined(ARDUINO_ARCH_ESP32)
+    return StaticArena::create<Esp32CoreTask>(name, core, priority);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostCoreTask>(name, core, priority);
+  #else
+    return nullptr;
+  #endif
+}
@@ -23,6 +23,11 @@
 #include "GpioFactory.h"
 #include "Stm32Gpio.h"
 #include "Esp32Gpio.h"
+#include "HostGpio.h"
+#include "Stm32GpioPort.h"
+#include "Esp32GpioPort.h"
+#include "HostGpioPort.h"
+#include "StaticArena.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -33,10 +38,31 @@
   ********************************************************************************************** */
 IGpio* GpioFactory::createGpio(uint8_t pin, uint8_t mode) {
   #ifdef ARDUINO_ARCH_STM32
-    return new Stm32Gpio(pin, mode);
+    return StaticArena::create<Stm32Gpio>(pin, mode);
   #elif defined(ARDUINO_ARCH_ESP32)
-    return new Esp32Gpio(pin, mode);
+    return StaticArena::create<Esp32Gpio>(pin, mode);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostGpio>(pin, mode);
   #else
     return nullptr;
   #endif
-} 
\ No newline at end of file
+}
+
+/**************************************************************************************************
+  * @brief      Create a GPIO port based on architecture
+  * @param      pins Pins of the port, bit i of the masks is pins[i]
+  * @param      count Number of pins, at most GPIO_PORT_MAX_PINS
+  * @param      mode Mode of every pin
+  * @return     GPIO port instance pointer
+  ********************************************************************************************** */
+IGpioPort* GpioFactory::createGpioPort(const uint8_t* pins, uint8_t count, uint8_t mode) {
+  #ifdef ARDUINO_ARCH_STM32
+    return StaticArena::create<Stm32GpioPort>(pins, count, mode);
+  #elif defined(ARDUINO_ARCH_ESP32)
+    return StaticArena::create<Esp32GpioPort>(pins, count, mode);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostGpioPort>(pins, count, mode);
+  #else
+    return nullptr;
+  #endif
+}
\ No newline at end of file
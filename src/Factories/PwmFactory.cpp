@@ -23,6 +23,11 @@
 #include "PwmFactory.h"
 #include "Stm32Pwm.h"
 #include "Esp32Pwm.h"
+#include "HostPwm.h"
+#include "Stm32PwmGroup.h"
+#include "Esp32PwmGroup.h"
+#include "HostPwmGroup.h"
+#include "StaticArena.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -33,10 +38,30 @@
   ********************************************************************************************** */
 IPwm* PwmFactory::createPwm(uint8_t pin) {
   #ifdef ARDUINO_ARCH_STM32
-    return new Stm32Pwm(pin);
+    return StaticArena::create<Stm32Pwm>(pin);
   #elif defined(ARDUINO_ARCH_ESP32)
-    return new Esp32Pwm(pin);
+    return StaticArena::create<Esp32Pwm>(pin);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostPwm>(pin);
   #else
     return nullptr;
   #endif
-} 
\ No newline at end of file
+} 
+
+/**************************************************************************************************
+  * @brief      Create PWM group instance based on architecture
+  * @param      pins Output pins, channel i drives pins[i]
+  * @param      count Number of pins
+  * @return     PWM group instance pointer
+  ********************************************************************************************** */
+IPwmGroup* PwmFactory::createPwmGroup(const uint8_t* pins, uint8_t count) {
+  #ifdef ARDUINO_ARCH_STM32
+    return StaticArena::create<Stm32PwmGroup>(pins, count);
+  #elif defined(ARDUINO_ARCH_ESP32)
+    return StaticArena::create<Esp32PwmGroup>(pins, count);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostPwmGroup>(pins, count);
+  #else
+    return nullptr;
+  #endif
+}
\ No newline at end of file
@@ -23,6 +23,8 @@
 #include "SerialFactory.h"
 #include "Stm32Serial.h"
 #include "Esp32Serial.h"
+#include "HostSerial.h"
+#include "StaticArena.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -33,9 +35,11 @@
   ********************************************************************************************** */
 ISerial* SerialFactory::createSerial(unsigned long baudRate) {
   #ifdef ARDUINO_ARCH_STM32
-    return new Stm32Serial(baudRate);
+    return StaticArena::create<Stm32Serial>(baudRate);
   #elif defined(ARDUINO_ARCH_ESP32)
-    return new Esp32Serial(baudRate);
+    return StaticArena::create<Esp32Serial>(baudRate);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostSerial>(baudRate);
   #else
     return nullptr;
   #endif
@@ -0,0 +1,47 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : WifiFactory.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : WiFi Factory Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "WifiFactory.h"
+#include "Esp32Wifi.h"
+#include "HostWifi.h"
+#include "StaticArena.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Create WiFi instance based on architecture
+  * @param      localPort UDP port to listen on
+  * @param      remotePort UDP port frames are sent to
+  * @return     WiFi instance pointer, nullptr on boards without a radio (STM32)
+  ********************************************************************************************** */
+IWifi* WifiFactory::createWifi(uint16_t localPort, uint16_t remotePort) {
+  #ifdef ARDUINO_ARCH_STM32
+    return nullptr;
+  #elif defined(ARDUINO_ARCH_ESP32)
+    return StaticArena::create<Esp32Wifi>(localPort, remotePort);
+  #elif defined(HOST_NATIVE)
+    return StaticArena::create<HostWifi>(localPort, remotePort);
+  #else
+    return nullptr;
+  #endif
+}
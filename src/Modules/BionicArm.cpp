@@ -14,6 +14,33 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "BionicArm.h"
+#include "StaticArena.h"
+#include "GestureModelData.h"
+#include <stdio.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+static_assert(GESTURE_MODEL_WINDOW == EMG_WINDOW && GESTURE_MODEL_HOP == EMG_HOP &&
+              GESTURE_MODEL_THRESHOLD == EMG_DEAD_BAND,
+              "Gesture model was trained with different feature settings, retrain it");
+static_assert(GESTURE_FINGERS == NUM_MOTORS, "Gesture table needs one trajectory per motor");
+static_assert(STAGE_COUNT <= LATENCY_TRACE_MAX_STAGES, "Too many traced stages");
+
+// Indexed by BionicArmStage
+static const char* const stageNames[STAGE_COUNT] = {
+  "emg", "buttons", "classifier", "execute", "motors", "send", "commands"
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+const CommandHandler BionicArm::commandHandlers[] = {
+  { COMMAND_SET_THRESHOLD,   2, BionicArm::onSetThreshold },
+  { COMMAND_TRIGGER_GESTURE, 1, BionicArm::onTriggerGesture },
+  { COMMAND_STREAM,          1, BionicArm::onStream },
+  { COMMAND_QUERY_STATS,     0, BionicArm::onQueryStats }
+};
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -21,46 +48,57 @@
 BionicArm::BionicArm(uint8_t emgPin, 
                      const uint8_t* motorPins,
                      const uint8_t* rowPins,
-                     const uint8_t* colPins) {
+                     const uint8_t* colPins)
+  : features(EMG_WINDOW, EMG_HOP, EMG_DEAD_BAND), classifier(gestureModel),
+    trace(stageNames, STAGE_COUNT),
+    commands(commandHandlers, sizeof(commandHandlers) / sizeof(commandHandlers[0]), this) {
   // Initialize EMG sensor
-  this->emg = new EmgSensor(emgPin);
+  this->emg = StaticArena::create<EmgSensor>(emgPin);
   
   // Initialize motors
+  this->motors = StaticArena::create<MotorBank>(motorPins, NUM_MOTORS);
   for (uint8_t i = 0; i < NUM_MOTORS; i++) {
-    this->motors[i] = new MotorDriver(motorPins[i*2], motorPins[i*2 + 1]);
+    this->motorSpeeds[i] = 0;
   }
+  this->telemetryPending = false;
+  this->latestFeatures = {};
+  this->hasGesture = false;
+  this->lastGesture = 0;
+  this->lastRms = 0;
+  this->activationRms = EMG_ACTIVATION_RMS;
+  this->streaming = true;
+  this->reportLine = REPORT_LINE_IDLE;
   
   // Initialize button matrix
-  this->buttonMatrix = new ButtonMatrix(rowPins, MATRIX_ROWS, colPins, MATRIX_COLS);
+  this->buttonMatrix = StaticArena::create<ButtonMatrix>(rowPins, MATRIX_ROWS,
+                                                         colPins, MATRIX_COLS);
   
   // Initialize communication
-  this->communication = new Communication();
+  this->communication = StaticArena::create<Communication>();
 }
 
 BionicArm::~BionicArm() {
   // Cleanup EMG sensor
   if (this->emg != nullptr) {
-    delete this->emg;
+    StaticArena::destroy(this->emg);
     this->emg = nullptr;
   }
   
   // Cleanup motors
-  for (uint8_t i = 0; i < NUM_MOTORS; i++) {
-    if (this->motors[i] != nullptr) {
-      delete this->motors[i];
-      this->motors[i] = nullptr;
-    }
+  if (this->motors != nullptr) {
+    StaticArena::destroy(this->motors);
+    this->motors = nullptr;
   }
   
   // Cleanup button matrix
   if (this->buttonMatrix != nullptr) {
-    delete this->buttonMatrix;
+    StaticArena::destroy(this->buttonMatrix);
     this->buttonMatrix = nullptr;
   }
   
   // Cleanup communication
   if (this->communication != nullptr) {
-    delete this->communication;
+    StaticArena::destroy(this->communication);
     this->communication = nullptr;
   }
 }
@@ -69,12 +107,11 @@ bool BionicArm::setup() {
   bool success = true;
   
   // Setup EMG sensor
-  success &= (this->emg != nullptr && this->emg->setup());
+  success &= (this->emg != nullptr && this->emg->setup() &&
+              this->emg->startAcquisition(EMG_SAMPLE_RATE_HZ));
   
   // Setup motors
-  for (uint8_t i = 0; i < NUM_MOTORS; i++) {
-    success &= (this->motors[i] != nullptr && this->motors[i]->setup());
-  }
+  success &= (this->motors != nullptr && this->motors->setup());
   
   // Setup button matrix
   success &= (this->buttonMatrix != nullptr && this->buttonMatrix->setup());
@@ -82,90 +119,422 @@ bool BionicArm::setup() {
   // Setup communication
   success &= (this->communication != nullptr && this->communication->setup());
   
+  // Check the gesture model
+  success &= this->classifier.valid();
+  
   return success;
 }
 
+/**************************************************************************************************
+  * @brief      Run every control step once
+  * @return     true if a gesture was started and every motor and the link succeeded
+  * @details    For a plain loop. Scheduled applications call the steps separately. Every step
+  *             runs on each call, a motor or link failure does not stall acquisition.
+  ********************************************************************************************** */
 bool BionicArm::doGesture() {
-  uint16_t emgValue;
-  uint8_t row, col;
+  // Move the fingers along the current gesture on every call
+  bool moved = updateMotors();
   
-  // Read EMG sensor
-  if (!processEmgSignal(emgValue)) {
+  // Update EMG features, decisions are only taken when a window is waiting in the queue,
+  // which classify() checks itself
+  acquire();
+  bool started = classify();
+  
+  // Send gesture data and answer requests from the link
+  bool sent = sendTelemetry();
+  
+  return moved && started && sent;
+}
+
+/**************************************************************************************************
+  * @brief      Acquisition step: take the samples converted since the last call
+  * @return     true when a new feature window was queued for classify()
+  * @details    Touches nothing classify() uses but the feature queue, so the two steps may
+  *             run on different cores.
+  ********************************************************************************************** */
+bool BionicArm::acquire() {
+  EmgFeatureVector emgFeatures;
+  this->trace.begin(STAGE_EMG);
+  bool updated = processEmgSignal(emgFeatures);
+  this->trace.end(STAGE_EMG);
+  return updated && this->featureQueue.push(emgFeatures);
+}
+
+/**************************************************************************************************
+  * @brief      Classification step: choose and start a gesture for the latest window
+  * @return     true if a gesture was started
+  * @details    Windows below the activation RMS (EMG_ACTIVATION_RMS until changed by
+  *             COMMAND_SET_THRESHOLD) are rest and keep the current gesture.
+  ********************************************************************************************** */
+bool BionicArm::classify() {
+  uint8_t gestureId;
+  EmgFeatureVector emgFeatures;
+  bool ready = false;
+  // Only the newest window counts when a late classifier finds several waiting
+  while (this->featureQueue.pop(emgFeatures)) {
+    ready = true;
+  }
+  if (!ready) {
+    return false;
+  }
+  this->latestFeatures = emgFeatures;
+
+  // Drain the button events on every window, presses made at rest are dropped
+  this->trace.begin(STAGE_BUTTONS);
+  bool pressed = pollButtons(gestureId);
+  this->trace.end(STAGE_BUTTONS);
+  
+  // Check if muscle activity is above threshold
+  if (this->latestFeatures.rms <= this->activationRms) {
     return false;
   }
   
-  // Check if EMG signal is above threshold
-  if (emgValue > EMG_THRESHOLD) {
-    // Read button matrix for gesture selection
-    if (this->buttonMatrix->read(row, col)) {
-      uint8_t gestureId = row * MATRIX_COLS + col;
-      
-      // Execute the gesture
-      if (!executeGesture(gestureId)) {
-        return false;
+  // A pressed button overrides the classifier, so the user can always force a gesture the
+  // model gets wrong
+  if (!pressed && !selectGesture(this->latestFeatures, gestureId)) {
+    return false;
+  }
+  this->trace.begin(STAGE_EXECUTE);
+  bool started = executeGesture(gestureId);
+  this->trace.end(STAGE_EXECUTE);
+  if (!started) {
+    return false;
+  }
+  this->hasGesture = true;
+  this->lastGesture = gestureId;
+  this->lastRms = this->latestFeatures.rms;
+  this->telemetryPending = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Telemetry step: handle link commands, queue the last started gesture once and
+  *             pass queued frames to the link
+  * @return     false only if an answer or report could not be queued or the link failed
+  ********************************************************************************************** */
+bool BionicArm::sendTelemetry() {
+  bool success = serviceRequests();
+  if (this->telemetryPending && !this->streaming) {
+    this->telemetryPending = false;
+  }
+  if (this->telemetryPending) {
+    this->telemetryPending = false;
+    this->trace.begin(STAGE_SEND);
+    success &= sendGestureData(this->lastGesture, this->lastRms);
+    this->trace.end(STAGE_SEND);
+  }
+  success &= this->communication->update();
+  return success;
+}
+
+/**************************************************************************************************
+  * @brief      Parse the bytes received on the link and handle the commands they complete
+  * @return     false only if an answer or a requested report could not be queued
+  * @details    At most COMMAND_BYTES_PER_STEP bytes are taken per call, the rest waits in the
+  *             receive buffer, so a burst on the link cannot stretch the step. Every command
+  *             is answered with its status. Bytes outside valid frames are ignored.
+  ********************************************************************************************** */
+bool BionicArm::serviceRequests() {
+  uint8_t received[16];
+  size_t bytesRead;
+  size_t parsed = 0;
+  uint8_t id;
+  uint8_t status;
+  bool success = true;
+  this->trace.begin(STAGE_COMMANDS);
+  while (parsed < COMMAND_BYTES_PER_STEP &&
+         this->communication->readData(received, sizeof(received), bytesRead) && bytesRead > 0) {
+    for (size_t i = 0; i < bytesRead; i++) {
+      if (this->commands.push(received[i], id, status)) {
+        success &= sendAnswer(id, status);
       }
-      
-      // Send gesture data
-      if (!sendGestureData(gestureId, emgValue)) {
-        return false;
+    }
+    parsed += bytesRead;
+  }
+  this->trace.end(STAGE_COMMANDS);
+  if (this->reportLine != REPORT_LINE_IDLE) {
+    success &= sendLatencyReport();
+  }
+  return success;
+}
+
+/**************************************************************************************************
+  * @brief      Latency histograms of the control stages
+  * @return     Trace, indexed by BionicArmStage
+  ********************************************************************************************** */
+const LatencyTrace& BionicArm::getTrace() const {
+  return this->trace;
+}
+
+/**************************************************************************************************
+  * @brief      Last gesture started by classify() or by COMMAND_TRIGGER_GESTURE
+  * @param[out] gestureId Gesture id
+  * @param[out] rms RMS of the window that started it, or of the latest window for a command
+  * @return     false if no gesture was started yet
+  ********************************************************************************************** */
+bool BionicArm::getLastGesture(uint8_t& gestureId, uint16_t& rms) const {
+  if (!this->hasGesture) {
+    return false;
+  }
+  gestureId = this->lastGesture;
+  rms = this->lastRms;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Feature windows lost because classify() fell FEATURE_QUEUE_WINDOWS behind
+  * @return     Number of windows dropped since construction
+  ********************************************************************************************** */
+uint32_t BionicArm::getDroppedWindows() const {
+  return this->featureQueue.overruns();
+}
+
+/**************************************************************************************************
+  * @brief      Motion step: advance the gesture interpolation and apply the new motor speeds
+  * @return     true if every motor accepted its command
+  * @details    Changed speeds are staged and committed together, so every finger starts
+  *             moving on the same PWM period.
+  ********************************************************************************************** */
+bool BionicArm::updateMotors() {
+  int16_t speeds[NUM_MOTORS];
+  bool success = true;
+  this->trace.begin(STAGE_MOTORS);
+  if (this->player.update(millis(), speeds)) {
+    bool changed = false;
+    for (uint8_t i = 0; i < NUM_MOTORS; i++) {
+      if (speeds[i] != this->motorSpeeds[i]) {
+        success &= this->motors->set(i, speeds[i]);
+        this->motorSpeeds[i] = speeds[i];
+        changed = true;
       }
-      
-      return true;
     }
+    success = success && (!changed || this->motors->commit());
   }
-  
-  return false;
+  this->trace.end(STAGE_MOTORS);
+  return success;
 }
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Private methods                                                                               */
 /*-----------------------------------------------------------------------------------------------*/
-bool BionicArm::processEmgSignal(uint16_t& emgValue) {
-  return this->emg->read(emgValue);
+bool BionicArm::processEmgSignal(EmgFeatureVector& emgFeatures) {
+  if (!this->emg->readBlock(this->emgBlock, EMG_BLOCK_SIZE) ||
+      !this->emg->filterBlock(this->emgBlock, this->filteredBlock, EMG_BLOCK_SIZE)) {
+    return false;
+  }
+  bool updated = false;
+  for (uint8_t i = 0; i < EMG_BLOCK_SIZE; i++) {
+    updated |= this->features.push(this->filteredBlock[i], emgFeatures);
+  }
+  return updated;
 }
 
-bool BionicArm::executeGesture(uint8_t gestureId) {
-  bool success = true;
-  
-  // Example gesture patterns (customize based on your needs)
-  switch (gestureId) {
-    case 0: // Fist
-      success &= this->motors[0]->forward(255);  // Thumb
-      success &= this->motors[1]->forward(255);  // Index
-      success &= this->motors[2]->forward(255);  // Middle
-      success &= this->motors[3]->forward(255);  // Ring
-      success &= this->motors[4]->forward(255);  // Pinky
-      break;
-      
-    case 1: // Peace sign
-      success &= this->motors[0]->stop();        // Thumb
-      success &= this->motors[1]->backward(255); // Index
-      success &= this->motors[2]->backward(255); // Middle
-      success &= this->motors[3]->forward(255);  // Ring
-      success &= this->motors[4]->forward(255);  // Pinky
-      break;
-      
-    // Add more gesture patterns here
-      
-    default:
-      // Stop all motors
-      for (uint8_t i = 0; i < NUM_MOTORS; i++) {
-        success &= this->motors[i]->stop();
-      }
-      break;
+/**************************************************************************************************
+  * @brief      Take the gesture requested on the button matrix
+  * @param[out] gestureId Gesture of the key
+  * @return     true if a key was pressed since the last call or is still held
+  * @details    The last press event wins, so a tap shorter than a classification period is
+  *             not lost. Costs one atomic exchange while no key changes.
+  ********************************************************************************************** */
+bool BionicArm::pollButtons(uint8_t& gestureId) {
+  ButtonEvent event;
+  uint32_t keys;
+  bool pressed = false;
+  this->buttonMatrix->update();
+  while (this->buttonMatrix->getEvent(event)) {
+    if (event.pressed) {
+      gestureId = event.row * MATRIX_COLS + event.col;
+      pressed = true;
+    }
   }
-  
-  return success;
+  if (!pressed && this->buttonMatrix->read(keys)) {
+    // Several keys held: the lowest row then column wins
+    gestureId = (uint8_t)__builtin_ctz(keys);
+    pressed = true;
+  }
+  return pressed;
+}
+
+/**************************************************************************************************
+  * @brief      Classify an active EMG window
+  * @param      emgFeatures Features of the window
+  * @param[out] gestureId Selected gesture
+  * @return     true if a gesture was selected
+  ********************************************************************************************** */
+bool BionicArm::selectGesture(const EmgFeatureVector& emgFeatures, uint8_t& gestureId) {
+  this->trace.begin(STAGE_CLASSIFIER);
+  bool classified = this->classifier.classify(emgFeatures, gestureId);
+  this->trace.end(STAGE_CLASSIFIER);
+  return classified;
+}
+
+/**************************************************************************************************
+  * @brief      Start the trajectories of a gesture from the gesture table
+  * @param      gestureId Gesture table entry
+  * @return     true if the gesture is known
+  * @details    Non blocking, the motors follow the gesture through updateMotors().
+  ********************************************************************************************** */
+bool BionicArm::executeGesture(uint8_t gestureId) {
+  return this->player.start(gestureId, millis());
 }
 
+/**************************************************************************************************
+  * @brief      Queue a TELEMETRY_GESTURE frame
+  * @param      gestureId Gesture started
+  * @param      emgValue RMS of the window that selected it
+  * @return     true if the frame was queued
+  ********************************************************************************************** */
 bool BionicArm::sendGestureData(uint8_t gestureId, uint16_t emgValue) {
-  // Prepare data packet
   uint8_t data[3] = {
     gestureId,
-    (uint8_t)(emgValue >> 8),   // High byte
-    (uint8_t)(emgValue & 0xFF)  // Low byte
+    (uint8_t)(emgValue & 0xFF),
+    (uint8_t)(emgValue >> 8)
   };
-  
+  return sendFrame(TELEMETRY_GESTURE, data, sizeof(data));
+}
+
+/**************************************************************************************************
+  * @brief      Send the next line of the latency report
+  * @return     true if the line was queued
+  * @details    One text line per call: the tracing overhead already subtracted from every
+  *             sample, one line per stage, then the static arena usage. Percentiles are upper
+  *             bounds of log-scale buckets, in ns. A line goes out as TELEMETRY_REPORT frames
+  *             and a TELEMETRY_REPORT_END frame follows the last line. One line per telemetry
+  *             step keeps the step short and the report within the transmit buffer.
+  ********************************************************************************************** */
+bool BionicArm::sendLatencyReport() {
+  char line[96];
+  size_t lineLength = 0;
+  uint8_t stageCount = this->trace.getStageCount();
+  if (this->reportLine == 0) {
+    int length = snprintf(line, sizeof(line), "overhead=%lu\n",
+                          (unsigned long)this->trace.getOverheadNs());
+    lineLength = length > 0 ? (size_t)length : 0;
+  } else if (this->reportLine <= stageCount) {
+    lineLength = this->trace.formatReport(this->reportLine - 1, line, sizeof(line));
+  } else if (this->reportLine == stageCount + 1) {
+    lineLength = StaticArena::formatReport(line, sizeof(line));
+  } else {
+    this->reportLine = REPORT_LINE_IDLE;
+    return sendFrame(TELEMETRY_REPORT_END, nullptr, 0);
+  }
+  this->reportLine++;
+  bool success = lineLength > 0;
+  for (size_t offset = 0; offset < lineLength; offset += COMMAND_MAX_PAYLOAD) {
+    size_t chunk = lineLength - offset < COMMAND_MAX_PAYLOAD ? lineLength - offset
+                                                              : COMMAND_MAX_PAYLOAD;
+    success &= sendFrame(TELEMETRY_REPORT, (const uint8_t*)&line[offset], (uint8_t)chunk);
+  }
+  return success;
+}
+
+/**************************************************************************************************
+  * @brief      Answer a command with its status
+  * @param      id Command id
+  * @param      status COMMAND_* status
+  * @return     true if the answer was queued
+  ********************************************************************************************** */
+bool BionicArm::sendAnswer(uint8_t id, uint8_t status) {
+  return sendFrame(id | COMMAND_ANSWER, &status, 1);
+}
+
+/**************************************************************************************************
+  * @brief      Queue one frame in the CommandFrame format
+  * @param      id Answer or telemetry id
+  * @param      payload Frame payload, may be nullptr when length is 0
+  * @param      length Payload length, at most COMMAND_MAX_PAYLOAD
+  * @return     true if the frame was queued
+  * @details    Header, payload and CRC are gathered by the link, no frame is assembled here.
+  ********************************************************************************************** */
+bool BionicArm::sendFrame(uint8_t id, const uint8_t* payload, uint8_t length) {
+  CommandFrameParts parts;
   size_t bytesWritten;
-  return this->communication->writeData(data, sizeof(data), bytesWritten);
-} 
\ No newline at end of file
+  if (!CommandFrame::frame(id, payload, length, parts)) {
+    return false;
+  }
+  TransportSpan spans[3] = {
+    { parts.header, COMMAND_HEADER_BYTES },
+    { payload, length },
+    { &parts.crc, 1 }
+  };
+  size_t count = 3;
+  if (length == 0) {
+    spans[1] = spans[2];
+    count = 2;
+  }
+  return this->communication->writeSpans(spans, count, bytesWritten);
+}
+
+/**************************************************************************************************
+  * @brief      COMMAND_SET_THRESHOLD: change the activation RMS
+  * @param      context The arm
+  * @param      payload uint16 RMS, little endian
+  * @param      length 2
+  * @return     COMMAND_REJECTED above the 12-bit range
+  ********************************************************************************************** */
+uint8_t BionicArm::onSetThreshold(void* context, const uint8_t* payload, uint8_t length) {
+  (void)length;
+  BionicArm* arm = (BionicArm*)context;
+  uint16_t rms = (uint16_t)(payload[0] | (payload[1] << 8));
+  if (rms > 4095) {
+    return COMMAND_REJECTED;
+  }
+  arm->activationRms = rms;
+  return COMMAND_OK;
+}
+
+/**************************************************************************************************
+  * @brief      COMMAND_TRIGGER_GESTURE: start a gesture whatever the EMG activity, reported
+  *             with the RMS of the latest window
+  * @param      context The arm
+  * @param      payload uint8 gesture id
+  * @param      length 1
+  * @return     COMMAND_REJECTED for an id with no gesture defined in the table
+  ********************************************************************************************** */
+uint8_t BionicArm::onTriggerGesture(void* context, const uint8_t* payload, uint8_t length) {
+  (void)length;
+  BionicArm* arm = (BionicArm*)context;
+  if (!arm->player.defined(payload[0]) || !arm->executeGesture(payload[0])) {
+    return COMMAND_REJECTED;
+  }
+  arm->hasGesture = true;
+  arm->lastGesture = payload[0];
+  arm->lastRms = arm->latestFeatures.rms;
+  arm->telemetryPending = true;
+  return COMMAND_OK;
+}
+
+/**************************************************************************************************
+  * @brief      COMMAND_STREAM: stop or restart the gesture telemetry
+  * @param      context The arm
+  * @param      payload uint8, 0 to stop, 1 to start
+  * @param      length 1
+  * @return     COMMAND_REJECTED for other values
+  ********************************************************************************************** */
+uint8_t BionicArm::onStream(void* context, const uint8_t* payload, uint8_t length) {
+  (void)length;
+  BionicArm* arm = (BionicArm*)context;
+  if (payload[0] > 1) {
+    return COMMAND_REJECTED;
+  }
+  arm->streaming = payload[0] == 1;
+  return COMMAND_OK;
+}
+
+/**************************************************************************************************
+  * @brief      COMMAND_QUERY_STATS: send the latency report after the answer, unless a
+  *             report is already being sent
+  * @param      context The arm
+  * @param      payload Unused
+  * @param      length 0
+  * @return     COMMAND_OK
+  ********************************************************************************************** */
+uint8_t BionicArm::onQueryStats(void* context, const uint8_t* payload, uint8_t length) {
+  (void)payload;
+  (void)length;
+  BionicArm* arm = (BionicArm*)context;
+  if (arm->reportLine == REPORT_LINE_IDLE) {
+    arm->reportLine = 0;
+  }
+  return COMMAND_OK;
+}
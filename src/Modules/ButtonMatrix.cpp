@@ -14,92 +14,190 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "ButtonMatrix.h"
+#include "StaticArena.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#ifndef IRAM_ATTR
+#define IRAM_ATTR                   // Interrupt handlers are placed in IRAM on the ESP32 only
+#endif
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
 /*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Button Matrix
+  * @param      rowPins Row pins, driven
+  * @param      rowCount Number of rows
+  * @param      colPins Column pins, pulled up
+  * @param      colCount Number of columns, rowCount x colCount at most BUTTON_MAX_KEYS
+  * @return     Nothing
+  ********************************************************************************************** */
 ButtonMatrix::ButtonMatrix(const uint8_t* rowPins, uint8_t rowCount, 
-                         const uint8_t* colPins, uint8_t colCount) {
+                         const uint8_t* colPins, uint8_t colCount)
+  : changed(false), lastEdgeUs(0), scanning(false) {
   this->rowCount = rowCount;
-  this->colCount = colCount;
-  
-  // Create GPIO arrays
-  this->rowGpios = new IGpio*[rowCount];
-  this->colGpios = new IGpio*[colCount];
-  
-  // Initialize row GPIOs
-  for (uint8_t i = 0; i < rowCount; i++) {
-    this->rowGpios[i] = GpioFactory::createGpio(rowPins[i], OUTPUT);
-  }
-  
-  // Initialize column GPIOs
-  for (uint8_t i = 0; i < colCount; i++) {
-    this->colGpios[i] = GpioFactory::createGpio(colPins[i], INPUT_PULLUP);
-  }
+  this->colCount = (rowCount * colCount <= BUTTON_MAX_KEYS) ? colCount : 0;
+  this->allRows = (uint32_t)((1ull << this->rowCount) - 1);
+  this->allCols = (uint32_t)((1ull << this->colCount) - 1);
+  this->debouncing = false;
+  this->firstEdgeUs = 0;
+  this->stableKeys = 0;
+  this->scanCount = 0;
+  this->rows = GpioFactory::createGpioPort(rowPins, this->rowCount, OUTPUT);
+  this->cols = GpioFactory::createGpioPort(colPins, this->colCount, INPUT_PULLUP);
 }
 
+/**************************************************************************************************
+  * @brief      Destructor for Button Matrix
+  * @return     Nothing
+  ********************************************************************************************** */
 ButtonMatrix::~ButtonMatrix() {
-  // Clean up row GPIOs
-  for (uint8_t i = 0; i < rowCount; i++) {
-    if (this->rowGpios[i] != nullptr) {
-      delete this->rowGpios[i];
-    }
+  if (this->rows != nullptr) {
+    StaticArena::destroy(this->rows);
+    this->rows = nullptr;
   }
-  delete[] this->rowGpios;
-  
-  // Clean up column GPIOs
-  for (uint8_t i = 0; i < colCount; i++) {
-    if (this->colGpios[i] != nullptr) {
-      delete this->colGpios[i];
-    }
+  if (this->cols != nullptr) {
+    this->cols->detachChangeInterrupt();
+    StaticArena::destroy(this->cols);
+    this->cols = nullptr;
   }
-  delete[] this->colGpios;
 }
 
+/**************************************************************************************************
+  * @brief      Setup the pins, read the initial state and arm the column interrupts
+  * @return     true if setup successful
+  * @details    Keys already held at setup are reported as press events.
+  ********************************************************************************************** */
 bool ButtonMatrix::setup() {
-  bool success = true;
-  
-  // Setup rows
-  for (uint8_t i = 0; i < rowCount; i++) {
-    if (this->rowGpios[i] != nullptr) {
-      success &= this->rowGpios[i]->setup();
+  if (this->rows == nullptr || this->cols == nullptr || this->colCount == 0 ||
+      !this->rows->setup() || !this->cols->setup()) {
+    return false;
+  }
+
+  // Idle state, then interrupts on every column
+  this->changed.store(false);
+  this->rows->write(this->allRows, 0);
+  bool success = this->cols->attachChangeInterrupt(onColumnChange, this);
+  this->lastEdgeUs.store(micros());
+  this->changed.store(true);
+  return success;
+}
+
+/**************************************************************************************************
+  * @brief      Run the debounce state machine, scan the matrix once the columns settle
+  * @return     true if events were queued
+  * @details    Call it from the control loop. Without a column edge since the last call it
+  *             returns after one atomic exchange. Edges during the debounce time restart it.
+  ********************************************************************************************** */
+bool ButtonMatrix::update() {
+  if (!this->debouncing) {
+    if (!this->changed.exchange(false, std::memory_order_acquire)) {
+      return false;
     }
+    this->debouncing = true;
+    this->firstEdgeUs = this->lastEdgeUs.load(std::memory_order_relaxed);
+    return false;
   }
-  
-  // Setup columns
-  for (uint8_t i = 0; i < colCount; i++) {
-    if (this->colGpios[i] != nullptr) {
-      success &= this->colGpios[i]->setup();
+  this->changed.store(false, std::memory_order_relaxed);
+  if ((uint32_t)(micros() - this->lastEdgeUs.load(std::memory_order_acquire)) <
+      BUTTON_DEBOUNCE_US) {
+    return false;
+  }
+  this->debouncing = false;
+
+  uint32_t keys = this->scan();
+  uint32_t changedKeys = keys ^ this->stableKeys;
+  bool queued = changedKeys != 0;
+  this->stableKeys = keys;
+  for (uint8_t key = 0; changedKeys != 0; key++, changedKeys >>= 1) {
+    if ((changedKeys & 1u) != 0) {
+      ButtonEvent event;
+      event.timeUs = this->firstEdgeUs;
+      event.row = key / this->colCount;
+      event.col = key % this->colCount;
+      event.pressed = (keys & (1u << key)) != 0;
+      this->events.push(event);
     }
   }
-  
-  return success;
+  return queued;
 }
 
-bool ButtonMatrix::read(uint8_t& row, uint8_t& col) {
-  // Scan matrix
+/**************************************************************************************************
+  * @brief      Take the oldest press or release event
+  * @param[out] event Event
+  * @return     false if no event is queued
+  ********************************************************************************************** */
+bool ButtonMatrix::getEvent(ButtonEvent& event) {
+  return this->events.pop(event);
+}
+
+/**************************************************************************************************
+  * @brief      Get every key held down, as of the last update()
+  * @param[out] keys Bit row * colCount + col set for each held key
+  * @return     false if no key is held
+  ********************************************************************************************** */
+bool ButtonMatrix::read(uint32_t& keys) {
+  keys = this->stableKeys;
+  return keys != 0;
+}
+
+/**************************************************************************************************
+  * @brief      Number of full matrix scans since setup
+  * @return     Scan count
+  ********************************************************************************************** */
+uint32_t ButtonMatrix::getScanCount() const {
+  return this->scanCount;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Read every key, one row at a time
+  * @return     Key bitmap
+  * @details    One port write and one port read per row. Column edges caused by the scan itself
+  *             are ignored. An edge from a key that changed during the scan is detected
+  *             afterwards and restarts the debounce.
+  ********************************************************************************************** */
+uint32_t ButtonMatrix::scan() {
+  uint32_t keys = 0;
+  uint32_t columns;
+  this->scanning.store(true, std::memory_order_relaxed);
   for (uint8_t r = 0; r < rowCount; r++) {
-    // Set current row low
-    if (this->rowGpios[r] != nullptr) {
-      this->rowGpios[r]->write(LOW);
-      
-      // Check all columns
-      for (uint8_t c = 0; c < colCount; c++) {
-        if (this->colGpios[c] != nullptr) {
-          uint8_t state;
-          if (this->colGpios[c]->read(state) && state == LOW) {
-            row = r;
-            col = c;
-            this->rowGpios[r]->write(HIGH);
-            return true;
-          }
-        }
-      }
-      
-      // Reset row to high
-      this->rowGpios[r]->write(HIGH);
+    this->rows->write(this->allRows, this->allRows & ~(1u << r));
+    if (this->cols->read(columns)) {
+      keys |= (~columns & this->allCols) << (r * this->colCount);
     }
   }
-  
-  return false;
-} 
\ No newline at end of file
+  this->rows->write(this->allRows, 0);
+  this->scanning.store(false, std::memory_order_relaxed);
+  this->scanCount++;
+
+  // With every row low, a column is low exactly when a key of that column is held
+  uint32_t heldColumns = 0;
+  for (uint8_t r = 0; r < rowCount; r++) {
+    heldColumns |= keys >> (r * this->colCount);
+  }
+  heldColumns &= this->allCols;
+  if (this->cols->read(columns) && (~columns & this->allCols) != heldColumns) {
+    this->lastEdgeUs.store(micros(), std::memory_order_relaxed);
+    this->changed.store(true, std::memory_order_release);
+  }
+  return keys;
+}
+
+/**************************************************************************************************
+  * @brief      Column change interrupt: record the edge, the work is done by update()
+  * @param      context The matrix
+  * @return     Nothing
+  ********************************************************************************************** */
+void IRAM_ATTR ButtonMatrix::onColumnChange(void* context) {
+  ButtonMatrix* matrix = (ButtonMatrix*)context;
+  if (matrix->scanning.load(std::memory_order_relaxed)) {
+    return;
+  }
+  matrix->lastEdgeUs.store(micros(), std::memory_order_relaxed);
+  matrix->changed.store(true, std::memory_order_release);
+}
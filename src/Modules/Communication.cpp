@@ -21,6 +21,8 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "Communication.h"
+#include "StaticArena.h"
+#include <string.h>
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -30,11 +32,21 @@
   * @return     Nothing
   ********************************************************************************************** */
 Communication::Communication() {
-  #ifdef WIFI_COMMUNICATION
-    this->comm = WifiFactory::createWifi();
+  #ifdef COMM_WIFI_LINK
+    this->comm = WifiFactory::createWifi(WIFI_LOCAL_PORT, WIFI_REMOTE_PORT);
   #else
     this->comm = SerialFactory::createSerial(115200);
   #endif
+  for (TxBuffer& buffer : this->txBuffers) {
+    buffer.length = 0;
+    buffer.sent = 0;
+    buffer.frames = 0;
+  }
+  this->fillIndex = 0;
+  this->dropPolicy = COMM_TX_DROP_POLICY;
+  this->framesQueued = 0;
+  this->framesDropped = 0;
+  this->bytesSent = 0;
 }
 
 /**************************************************************************************************
@@ -43,7 +55,7 @@ Communication::Communication() {
   ********************************************************************************************** */
 Communication::~Communication() {
   if (this->comm != nullptr) {
-    delete this->comm;
+    StaticArena::destroy(this->comm);
     this->comm = nullptr;
   }
 }
@@ -57,17 +69,60 @@ bool Communication::setup() {
 }
 
 /**************************************************************************************************
-  * @brief      Write data to communication channel
-  * @param      data Data buffer to write
-  * @param      length Length of data
-  * @param      bytesWritten Number of bytes written
-  * @return     true if write successful
+  * @brief      Queue a frame for transmission, never waits on the link
+  * @param      spans Parts of the frame, gathered into the queue in order
+  * @param      count Number of spans
+  * @param      bytesWritten Number of bytes queued, the frame length or 0
+  * @return     true if the frame was queued
+  * @details    The frame is sent whole and in order by later update() calls. With
+  *             TX_DROP_NEWEST a frame that does not fit is dropped, with TX_DROP_OLDEST the
+  *             frames waiting in the fill buffer are dropped to make room. Frames larger than
+  *             COMM_TX_BUFFER_BYTES are always dropped. Over WiFi the datagram batch of the
+  *             link is the queue and the frame goes straight to it.
   ********************************************************************************************** */
-bool Communication::writeData(const uint8_t* data, size_t length, size_t& bytesWritten) {
-  if (this->comm == nullptr || data == nullptr || length == 0) {
+bool Communication::writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) {
+  bytesWritten = 0;
+  size_t length = ITransport::totalLength(spans, count);
+  if (this->comm == nullptr || spans == nullptr || length == 0) {
     return false;
   }
-  return this->comm->writeData(data, length, bytesWritten);
+  #ifdef COMM_WIFI_LINK
+    if (!this->comm->writeSpans(spans, count, bytesWritten)) {
+      this->framesDropped++;
+      return false;
+    }
+    this->framesQueued++;
+    this->bytesSent += (uint32_t)bytesWritten;
+    return true;
+  #else
+    TxBuffer& drain = this->txBuffers[this->fillIndex ^ 1];
+    if (length > COMM_TX_BUFFER_BYTES - this->txBuffers[this->fillIndex].length &&
+        drain.sent == drain.length) {
+      // Drain buffer idle: swap now rather than wait for update()
+      drain.length = 0;
+      drain.sent = 0;
+      drain.frames = 0;
+      this->fillIndex ^= 1;
+    }
+    TxBuffer& fill = this->txBuffers[this->fillIndex];
+    if (length > COMM_TX_BUFFER_BYTES - fill.length) {
+      if (this->dropPolicy == TX_DROP_NEWEST || length > COMM_TX_BUFFER_BYTES) {
+        this->framesDropped++;
+        return false;
+      }
+      this->framesDropped += fill.frames;
+      fill.length = 0;
+      fill.frames = 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+      memcpy(&fill.data[fill.length], spans[i].data, spans[i].length);
+      fill.length += spans[i].length;
+    }
+    fill.frames++;
+    this->framesQueued++;
+    bytesWritten = length;
+    return true;
+  #endif
 }
 
 /**************************************************************************************************
@@ -82,4 +137,97 @@ bool Communication::readData(uint8_t* buffer, size_t length, size_t& bytesRead)
     return false;
   }
   return this->comm->readData(buffer, length, bytesRead);
-} 
\ No newline at end of file
+}
+
+/**************************************************************************************************
+  * @brief      Largest frame writeSpans() queues without dropping anything
+  * @param      space Free bytes of the fill buffer, or of a whole buffer when the other one is
+  *             idle; over WiFi the answer of the link
+  * @return     false if there is no link
+  ********************************************************************************************** */
+bool Communication::availableForWrite(size_t& space) {
+  if (this->comm == nullptr) {
+    return false;
+  }
+  #ifdef COMM_WIFI_LINK
+    return this->comm->availableForWrite(space);
+  #else
+    const TxBuffer& drain = this->txBuffers[this->fillIndex ^ 1];
+    space = drain.sent == drain.length
+          ? COMM_TX_BUFFER_BYTES
+          : COMM_TX_BUFFER_BYTES - this->txBuffers[this->fillIndex].length;
+    return true;
+  #endif
+}
+
+/**************************************************************************************************
+  * @brief      Hand queued bytes to the link, as many as it accepts without blocking
+  * @return     false if the link failed
+  * @details    Call periodically, at a rate where the link FIFO cannot run dry between calls.
+  *             Frames may be split across calls, the bytes still leave in order. Over WiFi
+  *             this sends the pending datagram once its flush deadline is reached.
+  ********************************************************************************************** */
+bool Communication::update() {
+  if (this->comm == nullptr) {
+    return false;
+  }
+  #ifdef COMM_WIFI_LINK
+    return this->comm->update();
+  #else
+    while (true) {
+      TxBuffer& drain = this->txBuffers[this->fillIndex ^ 1];
+      if (drain.sent == drain.length) {
+        drain.length = 0;
+        drain.sent = 0;
+        drain.frames = 0;
+        if (this->txBuffers[this->fillIndex].length == 0) {
+          return true;
+        }
+        this->fillIndex ^= 1;
+        continue;
+      }
+      size_t chunk = drain.length - drain.sent;
+      size_t bytesWritten = 0;
+      size_t space;
+      if (!this->comm->availableForWrite(space)) {
+        return false;
+      }
+      if (space == 0) {
+        return true;
+      }
+      chunk = chunk < space ? chunk : space;
+      if (!this->comm->writeData(&drain.data[drain.sent], chunk, bytesWritten) &&
+          bytesWritten == 0) {
+        return false;
+      }
+      drain.sent += bytesWritten;
+      this->bytesSent += (uint32_t)bytesWritten;
+      if (bytesWritten < chunk) {
+        return true;
+      }
+    }
+  #endif
+}
+
+/**************************************************************************************************
+  * @brief      Choose what writeData() drops when the fill buffer is full
+  * @param      policy TX_DROP_NEWEST or TX_DROP_OLDEST
+  * @return     Nothing
+  ********************************************************************************************** */
+void Communication::setDropPolicy(TxDropPolicy policy) {
+  this->dropPolicy = policy;
+}
+
+/**************************************************************************************************
+  * @brief      Transmit queue counters since construction
+  * @param      stats Receives the counters
+  * @return     Nothing
+  ********************************************************************************************** */
+void Communication::getTxStats(TxQueueStats& stats) const {
+  const TxBuffer& fill = this->txBuffers[this->fillIndex];
+  const TxBuffer& drain = this->txBuffers[this->fillIndex ^ 1];
+  stats.framesQueued = this->framesQueued;
+  stats.framesDropped = this->framesDropped;
+  stats.bytesSent = this->bytesSent;
+  stats.bytesPending = fill.length + drain.length - drain.sent;
+}
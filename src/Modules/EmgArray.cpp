@@ -0,0 +1,131 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgArray.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Multi-channel EMG electrode array Implementation
+ *
+ **************************************************************************************************
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "EmgArray.h"
+#include "StaticArena.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for EMG array
+  * @param      pins Electrode pins in scan order
+  * @param      count Number of electrodes, at most ADC_SCAN_MAX_CHANNELS
+  * @return     Nothing
+  ********************************************************************************************** */
+EmgArray::EmgArray(const uint8_t* pins, uint8_t count) : filter(emgFilterCascade) {
+  this->scan = AdcFactory::createAdcScan(pins, count);
+  this->channelCount = (this->scan != nullptr) ? this->scan->channelCount() : 0;
+  this->blockFill = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Destructor for EMG array
+  * @return     Nothing
+  ********************************************************************************************** */
+EmgArray::~EmgArray() {
+  if (this->scan != nullptr) {
+    StaticArena::destroy(this->scan);
+    this->scan = nullptr;
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Setup EMG array
+  * @return     true if setup successful
+  ********************************************************************************************** */
+bool EmgArray::setup() {
+  return (this->scan != nullptr && this->scan->setup());
+}
+
+/**************************************************************************************************
+  * @brief      Number of electrodes
+  * @return     Channel count
+  ********************************************************************************************** */
+uint8_t EmgArray::getChannelCount() const {
+  return this->channelCount;
+}
+
+/**************************************************************************************************
+  * @brief      Start scanning every electrode
+  * @param      scanRateHz Scans per second, filterBlock() expects EMG_SAMPLE_RATE_HZ
+  * @return     true if acquisition started
+  ********************************************************************************************** */
+bool EmgArray::startAcquisition(uint32_t scanRateHz) {
+  this->blockFill = 0;
+  this->filter.reset();
+  return (this->scan != nullptr && this->scan->startScan(scanRateHz));
+}
+
+/**************************************************************************************************
+  * @brief      Stop scanning
+  * @return     true if acquisition stopped
+  ********************************************************************************************** */
+bool EmgArray::stopAcquisition() {
+  this->blockFill = 0;
+  return (this->scan != nullptr && this->scan->stopScan());
+}
+
+/**************************************************************************************************
+  * @brief      Collect a whole block of scans without blocking
+  * @param      block One buffer of blockSize samples per channel, must be the same buffers
+  *             until the block is complete
+  * @param      timestampsUs Scan times, blockSize entries, may be nullptr
+  * @param      blockSize Number of scans per block
+  * @return     true once the block is full, false while it is still being filled
+  ********************************************************************************************** */
+bool EmgArray::readBlock(uint16_t* const* block, uint32_t* timestampsUs, size_t blockSize) {
+  if (this->scan == nullptr || block == nullptr || this->blockFill >= blockSize) {
+    return false;
+  }
+  uint16_t* channels[ADC_SCAN_MAX_CHANNELS];
+  for (uint8_t c = 0; c < this->channelCount; c++) {
+    channels[c] = block[c] + this->blockFill;
+  }
+  uint32_t* timestamps = (timestampsUs != nullptr) ? timestampsUs + this->blockFill : nullptr;
+  size_t scansRead = 0;
+  if (this->scan->readScans(channels, timestamps, blockSize - this->blockFill, scansRead)) {
+    this->blockFill += scansRead;
+  }
+  if (this->blockFill < blockSize) {
+    return false;
+  }
+  this->blockFill = 0;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Filter a block of raw scans, channel by channel
+  * @param      raw One buffer of raw ADC samples per channel
+  * @param      filtered One buffer of filtered samples per channel, centred on zero, may not
+  *             alias raw
+  * @param      count Number of scans
+  * @return     true if the block was filtered
+  * @details    Same chain as EmgSensor, with an independent state per channel.
+  ********************************************************************************************** */
+bool EmgArray::filterBlock(const uint16_t* const* raw, int16_t* const* filtered, size_t count) {
+  if (raw == nullptr || filtered == nullptr) {
+    return false;
+  }
+  for (uint8_t c = 0; c < this->channelCount; c++) {
+    const uint16_t* in = raw[c];
+    int16_t* out = filtered[c];
+    for (size_t i = 0; i < count; i++) {
+      out[i] = (int16_t)(in[i] - EMG_ADC_MIDSCALE);
+    }
+    this->filter.process(c, out, out, count);
+  }
+  return true;
+}
@@ -14,6 +14,7 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "EmgSensor.h"
+#include "StaticArena.h"
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -22,8 +23,7 @@
   * @brief      Constructor for EMG Sensor
   * @return     Nothing
   ********************************************************************************************** */
-EmgSensor::EmgSensor(uint8_t pin) {
-  this->adc = AdcFactory::createAdc(pin);
+EmgSensor::EmgSensor(uint8_t pin) : BasicEmgSensor<IAdc>(AdcFactory::createAdc(pin)) {
 }
 
 /**************************************************************************************************
@@ -32,23 +32,7 @@ EmgSensor::EmgSensor(uint8_t pin) {
   ********************************************************************************************** */
 EmgSensor::~EmgSensor() {
   if (this->adc != nullptr) {
-    delete this->adc;
+    StaticArena::destroy(this->adc);
     this->adc = nullptr;
   }
 }
-
-/**************************************************************************************************
-  * @brief      Setup EMG sensor
-  * @return     true if setup successful
-  ********************************************************************************************** */
-bool EmgSensor::setup() {
-  return (this->adc != nullptr && this->adc->setup());
-}
-
-/**************************************************************************************************
-  * @brief      Read EMG value
-  * @return     true if read successful
-  ********************************************************************************************** */
-bool EmgSensor::read(uint16_t& value) {
-  return (this->adc != nullptr && this->adc->read(value));
-} 
\ No newline at end of file
@@ -0,0 +1,66 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : MotorBank.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Motor Bank Implementation
+ * 
+ **************************************************************************************************
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "MotorBank.h"
+#include "StaticArena.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+MotorBank::MotorBank(const uint8_t* motorPins, uint8_t motorCount) {
+  this->motorCount = motorCount < MOTOR_BANK_MAX_MOTORS ? motorCount : MOTOR_BANK_MAX_MOTORS;
+  this->pwmGroup = PwmFactory::createPwmGroup(motorPins, this->motorCount * 2);
+}
+
+MotorBank::~MotorBank() {
+  if (this->pwmGroup != nullptr) {
+    StaticArena::destroy(this->pwmGroup);
+    this->pwmGroup = nullptr;
+  }
+}
+
+bool MotorBank::setup() {
+  return (this->pwmGroup != nullptr && this->pwmGroup->setup() &&
+          this->pwmGroup->channelCount() == this->motorCount * 2);
+}
+
+/**************************************************************************************************
+  * @brief      Stage the speed of one motor
+  * @param      motor Motor index
+  * @param      speed -255 (backward) .. 255 (forward), 0 stops
+  * @return     true if the motor exists
+  ********************************************************************************************** */
+bool MotorBank::set(uint8_t motor, int16_t speed) {
+  if (this->pwmGroup == nullptr || motor >= this->motorCount) {
+    return false;
+  }
+  if (speed > 255) {
+    speed = 255;
+  } else if (speed < -255) {
+    speed = -255;
+  }
+  uint8_t forwardDuty = speed > 0 ? (uint8_t)speed : 0;
+  uint8_t backwardDuty = speed < 0 ? (uint8_t)-speed : 0;
+  return (this->pwmGroup->stage(motor * 2, forwardDuty) &&
+          this->pwmGroup->stage(motor * 2 + 1, backwardDuty));
+}
+
+/**************************************************************************************************
+  * @brief      Apply the staged speeds of every motor at once
+  * @return     true if the outputs were updated
+  ********************************************************************************************** */
+bool MotorBank::commit() {
+  return (this->pwmGroup != nullptr && this->pwmGroup->commit());
+}
@@ -0,0 +1,218 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : CommandFrame.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Command frame encoder and incremental parser Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "CommandFrame.h"
+#include <string.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+// CRC-8 lookup table (polynomial 0x07)
+static const uint8_t crcTable[256] = {
+  0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31,
+  0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65,
+  0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9,
+  0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+  0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1,
+  0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2,
+  0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE,
+  0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+  0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16,
+  0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42,
+  0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80,
+  0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+  0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8,
+  0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C,
+  0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10,
+  0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+  0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F,
+  0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B,
+  0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7,
+  0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+  0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF,
+  0xFA, 0xFD, 0xF4, 0xF3
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Build a command or answer frame
+  * @param      id Command id, with COMMAND_ANSWER set for an answer
+  * @param      payload Arguments, may be nullptr when length is 0
+  * @param      length Payload length, at most COMMAND_MAX_PAYLOAD
+  * @param[out] out Buffer receiving the frame
+  * @param      outSize Size of the buffer, COMMAND_FRAME_BYTES(length) is enough
+  * @param[out] outLength Number of bytes to transmit
+  * @return     true if the frame was built
+  ********************************************************************************************** */
+bool CommandFrame::encode(uint8_t id, const uint8_t* payload, uint8_t length,
+                          uint8_t* out, size_t outSize, size_t& outLength) {
+  if (out == nullptr || length > COMMAND_MAX_PAYLOAD ||
+      outSize < (size_t)COMMAND_FRAME_BYTES(length) || (payload == nullptr && length > 0)) {
+    return false;
+  }
+  CommandFrameParts parts;
+  frame(id, payload, length, parts);
+  memcpy(out, parts.header, COMMAND_HEADER_BYTES);
+  if (length > 0) {
+    memcpy(&out[COMMAND_HEADER_BYTES], payload, length);
+  }
+  out[COMMAND_HEADER_BYTES + length] = parts.crc;
+  outLength = COMMAND_FRAME_BYTES(length);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Build the header and trailer around a payload, without copying it
+  * @param      id Command id, with COMMAND_ANSWER set for an answer
+  * @param      payload Arguments, may be nullptr when length is 0
+  * @param      length Payload length, at most COMMAND_MAX_PAYLOAD
+  * @param[out] parts Header and CRC, to send as header, payload, crc spans
+  * @return     true if the frame is valid
+  ********************************************************************************************** */
+bool CommandFrame::frame(uint8_t id, const uint8_t* payload, uint8_t length,
+                         CommandFrameParts& parts) {
+  if (length > COMMAND_MAX_PAYLOAD || (payload == nullptr && length > 0)) {
+    return false;
+  }
+  parts.header[0] = COMMAND_SYNC;
+  parts.header[1] = id;
+  parts.header[2] = length;
+  uint8_t crc = crc8(length, crc8(id, 0));
+  for (uint8_t i = 0; i < length; i++) {
+    crc = crc8(payload[i], crc);
+  }
+  parts.crc = crc;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Add one byte to a CRC-8
+  * @param      byte Next byte
+  * @param      crc CRC of the previous bytes, 0 to start
+  * @return     Updated CRC
+  ********************************************************************************************** */
+uint8_t CommandFrame::crc8(uint8_t byte, uint8_t crc) {
+  return crcTable[crc ^ byte];
+}
+
+/**************************************************************************************************
+  * @brief      Constructor
+  * @param      handlers Handler table, must outlive the parser
+  * @param      handlerCount Number of entries in the table
+  * @param      context Passed to every handler
+  * @return     Nothing
+  ********************************************************************************************** */
+CommandParser::CommandParser(const CommandHandler* handlers, uint8_t handlerCount,
+                             void* context) {
+  this->handlers = handlers;
+  this->handlerCount = handlers != nullptr ? handlerCount : 0;
+  this->context = context;
+  this->state = STATE_SYNC;
+  this->id = 0;
+  this->length = 0;
+  this->received = 0;
+  this->crc = 0;
+  this->errorCount = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Feed one received byte
+  * @param      byte Next byte from the link
+  * @param[out] id Id of the completed command
+  * @param[out] status COMMAND_* status to answer with
+  * @return     true if this byte completed a valid frame, which has then been dispatched
+  * @details    Constant time per byte, plus the handler when a frame completes. A length
+  *             above COMMAND_MAX_PAYLOAD or a CRC mismatch counts as an error and the
+  *             parser looks for the next sync byte.
+  ********************************************************************************************** */
+bool CommandParser::push(uint8_t byte, uint8_t& id, uint8_t& status) {
+  switch (this->state) {
+    case STATE_SYNC:
+      if (byte == COMMAND_SYNC) {
+        this->state = STATE_ID;
+      }
+      return false;
+    case STATE_ID:
+      this->id = byte;
+      this->crc = CommandFrame::crc8(byte, 0);
+      this->state = STATE_LENGTH;
+      return false;
+    case STATE_LENGTH:
+      if (byte > COMMAND_MAX_PAYLOAD) {
+        this->errorCount++;
+        this->state = byte == COMMAND_SYNC ? STATE_ID : STATE_SYNC;
+        return false;
+      }
+      this->length = byte;
+      this->received = 0;
+      this->crc = CommandFrame::crc8(byte, this->crc);
+      this->state = byte > 0 ? STATE_PAYLOAD : STATE_CRC;
+      return false;
+    case STATE_PAYLOAD:
+      this->payload[this->received++] = byte;
+      this->crc = CommandFrame::crc8(byte, this->crc);
+      if (this->received == this->length) {
+        this->state = STATE_CRC;
+      }
+      return false;
+    case STATE_CRC:
+    default:
+      this->state = STATE_SYNC;
+      if (byte != this->crc) {
+        this->errorCount++;
+        return false;
+      }
+      id = this->id;
+      status = dispatch();
+      return true;
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Frames rejected since construction
+  * @return     Number of oversized lengths and CRC mismatches
+  ********************************************************************************************** */
+uint32_t CommandParser::errors() const {
+  return this->errorCount;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Call the handler of the completed frame
+  * @return     Status returned by the handler, or why no handler ran
+  ********************************************************************************************** */
+uint8_t CommandParser::dispatch() {
+  for (uint8_t i = 0; i < this->handlerCount; i++) {
+    const CommandHandler& handler = this->handlers[i];
+    if (handler.id == this->id) {
+      if (handler.length != this->length) {
+        return COMMAND_BAD_LENGTH;
+      }
+      return handler.callback(this->context, this->payload, this->length);
+    }
+  }
+  return COMMAND_UNKNOWN;
+}
@@ -0,0 +1,280 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgCodec.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Lossless EMG sample codec Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "EmgCodec.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Helpers                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+// MSB first bit writer, flushes 32 bits at a time. Bits past size are counted, not written.
+struct BitWriter {
+  uint8_t* out;
+  size_t size;
+  size_t length;
+  uint64_t accumulator;
+  uint32_t bits;
+
+  void put(uint32_t value, uint32_t count) {
+    this->accumulator = (this->accumulator << count) | value;
+    this->bits += count;
+    if (this->bits >= 32) {
+      this->bits -= 32;
+      uint32_t word = (uint32_t)(this->accumulator >> this->bits);
+      if (this->length + 4 <= this->size) {
+        this->out[this->length] = (uint8_t)(word >> 24);
+        this->out[this->length + 1] = (uint8_t)(word >> 16);
+        this->out[this->length + 2] = (uint8_t)(word >> 8);
+        this->out[this->length + 3] = (uint8_t)word;
+      }
+      this->length += 4;
+    }
+  }
+
+  void flush() {
+    while (this->bits >= 8) {
+      this->bits -= 8;
+      this->putByte((uint8_t)(this->accumulator >> this->bits));
+    }
+    if (this->bits > 0) {
+      this->putByte((uint8_t)(this->accumulator << (8 - this->bits)));
+      this->bits = 0;
+    }
+  }
+
+  void putByte(uint8_t value) {
+    if (this->length < this->size) {
+      this->out[this->length] = value;
+    }
+    this->length++;
+  }
+};
+
+// MSB first bit reader, the next bits are the top of the window, bits below count are zero
+struct BitReader {
+  const uint8_t* in;
+  size_t length;
+  size_t position;
+  uint64_t window;
+  uint32_t count;
+
+  void refill() {
+    if (this->position + 8 <= this->length) {
+      const uint8_t* p = &this->in[this->position];
+      uint64_t word = ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) | ((uint64_t)p[2] << 40) |
+                      ((uint64_t)p[3] << 32) | ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) |
+                      ((uint64_t)p[6] << 8) | (uint64_t)p[7];
+      this->window |= word >> this->count;
+      this->position += (63 - this->count) >> 3;
+      this->count |= 56;
+    } else {
+      while (this->count <= 56 && this->position < this->length) {
+        this->window |= (uint64_t)this->in[this->position++] << (56 - this->count);
+        this->count += 8;
+      }
+    }
+  }
+
+  bool take(uint32_t bits, uint32_t& value) {
+    if (bits > this->count) {
+      return false;
+    }
+    value = (uint32_t)(this->window >> (64 - bits));
+    this->window <<= bits;
+    this->count -= bits;
+    return true;
+  }
+
+  // Zigzag mapped residual coded with parameter k
+  bool residual(uint32_t k, uint32_t& value) {
+    uint32_t zeros = (uint32_t)__builtin_clzll(this->window | 1);
+    if (zeros >= EMG_CODEC_ESCAPE) {
+      if (EMG_CODEC_ESCAPE + EMG_CODEC_RAW_BITS > this->count) {
+        return false;
+      }
+      value = (uint32_t)((this->window << EMG_CODEC_ESCAPE) >> (64 - EMG_CODEC_RAW_BITS));
+      this->window <<= EMG_CODEC_ESCAPE + EMG_CODEC_RAW_BITS;
+      this->count -= EMG_CODEC_ESCAPE + EMG_CODEC_RAW_BITS;
+      return true;
+    }
+    uint32_t bits = zeros + 1 + k;
+    if (bits > this->count) {
+      return false;
+    }
+    uint32_t low = (uint32_t)(((this->window << (zeros + 1)) >> 1) >> (63 - k));
+    value = (zeros << k) | low;
+    this->window <<= bits;
+    this->count -= bits;
+    return true;
+  }
+};
+
+static inline uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// One block of samples, the predictor order is a template argument to keep the loop branch free
+template <uint32_t order>
+static bool decodeBlock(BitReader& reader, uint32_t k, uint16_t* channel, size_t stride,
+                        size_t count, int32_t& previous, int32_t& beforePrevious) {
+  for (size_t i = 0; i < count; i++) {
+    if (reader.count < EMG_CODEC_ESCAPE + EMG_CODEC_RAW_BITS) {
+      reader.refill();
+    }
+    uint32_t residual;
+    if (!reader.residual(k, residual)) {
+      return false;
+    }
+    int32_t prediction = order == 0 ? EMG_CODEC_MIDSCALE
+                       : order == 1 ? previous : 2 * previous - beforePrevious;
+    int32_t value = prediction + unzigzag(residual);
+    if ((uint32_t)value > 0x0FFF) {
+      return false;
+    }
+    channel[i * stride] = (uint16_t)value;
+    beforePrevious = previous;
+    previous = value;
+  }
+  return true;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Compress interleaved 12-bit samples
+  * @param      samples count samples, channels per scan, only the low 12 bits are kept
+  * @param      count Number of samples, a multiple of channels
+  * @param      channels Channels per scan
+  * @param[out] out Compressed stream
+  * @param      outSize Size of out
+  * @param[out] outLength Length of the stream
+  * @return     true if the stream fits outSize
+  * @details    Each sample costs the same work: three residuals, then one bounded write.
+  *             Past outSize the stream is only measured, so a failure costs a normal encode.
+  ********************************************************************************************** */
+bool EmgCodec::encode(const uint16_t* samples, size_t count, uint8_t channels,
+                      uint8_t* out, size_t outSize, size_t& outLength) {
+  if (samples == nullptr || out == nullptr || channels == 0 || count % channels != 0) {
+    return false;
+  }
+  size_t perChannel = count / channels;
+  BitWriter writer = { out, outSize, 0, 0, 0 };
+  for (uint8_t c = 0; c < channels; c++) {
+    if (perChannel == 0) {
+      break;
+    }
+    const uint16_t* channel = &samples[c];
+    int32_t previous = channel[0] & 0x0FFF;
+    int32_t beforePrevious = previous;
+    writer.put((uint32_t)previous, 12);
+    for (size_t start = 1; start < perChannel; start += EMG_CODEC_BLOCK) {
+      size_t length = perChannel - start < EMG_CODEC_BLOCK ? perChannel - start : EMG_CODEC_BLOCK;
+      uint32_t residuals[3][EMG_CODEC_BLOCK];
+      uint32_t sums[3] = {0, 0, 0};
+      for (size_t i = 0; i < length; i++) {
+        int32_t value = channel[(start + i) * channels] & 0x0FFF;
+        residuals[0][i] = zigzag(value - EMG_CODEC_MIDSCALE);
+        residuals[1][i] = zigzag(value - previous);
+        residuals[2][i] = zigzag(value - 2 * previous + beforePrevious);
+        sums[0] += residuals[0][i];
+        sums[1] += residuals[1][i];
+        sums[2] += residuals[2][i];
+        beforePrevious = previous;
+        previous = value;
+      }
+      uint32_t order = sums[1] < sums[0] ? 1 : 0;
+      order = sums[2] < sums[order] ? 2 : order;
+      uint32_t mean = sums[order] / (uint32_t)length;
+      uint32_t k = mean > 0 ? 31 - (uint32_t)__builtin_clz(mean) : 0;
+      k = k > EMG_CODEC_MAX_K ? EMG_CODEC_MAX_K : k;
+      writer.put((order << 4) | k, 6);
+      const uint32_t* residual = residuals[order];
+      for (size_t i = 0; i < length; i++) {
+        uint32_t quotient = residual[i] >> k;
+        if (quotient < EMG_CODEC_ESCAPE) {
+          writer.put((1u << k) | (residual[i] & ((1u << k) - 1)), quotient + 1 + k);
+        } else {
+          writer.put(residual[i], EMG_CODEC_ESCAPE + EMG_CODEC_RAW_BITS);
+        }
+      }
+    }
+  }
+  writer.flush();
+  outLength = writer.length;
+  return writer.length <= outSize;
+}
+
+/**************************************************************************************************
+  * @brief      Decompress a stream produced by encode()
+  * @param      in Compressed stream
+  * @param      length Length of the stream
+  * @param      channels Channels per scan
+  * @param[out] samples count interleaved samples
+  * @param      count Number of samples expected, a multiple of channels
+  * @return     true if the stream decodes to count 12-bit samples and ends with the last one
+  ********************************************************************************************** */
+bool EmgCodec::decode(const uint8_t* in, size_t length, uint8_t channels,
+                      uint16_t* samples, size_t count) {
+  if (in == nullptr || samples == nullptr || channels == 0 || count % channels != 0) {
+    return false;
+  }
+  size_t perChannel = count / channels;
+  BitReader reader = { in, length, 0, 0, 0 };
+  for (uint8_t c = 0; c < channels; c++) {
+    if (perChannel == 0) {
+      break;
+    }
+    uint16_t* channel = &samples[c];
+    uint32_t first;
+    reader.refill();
+    if (!reader.take(12, first)) {
+      return false;
+    }
+    int32_t previous = (int32_t)first;
+    int32_t beforePrevious = previous;
+    channel[0] = (uint16_t)first;
+    for (size_t start = 1; start < perChannel; start += EMG_CODEC_BLOCK) {
+      size_t end = perChannel - start < EMG_CODEC_BLOCK ? perChannel : start + EMG_CODEC_BLOCK;
+      uint32_t header;
+      reader.refill();
+      if (!reader.take(6, header) || (header >> 4) > 2 || (header & 0x0F) > EMG_CODEC_MAX_K) {
+        return false;
+      }
+      uint32_t k = header & 0x0F;
+      uint16_t* block = &channel[start * channels];
+      bool decoded = (header >> 4) == 0
+        ? decodeBlock<0>(reader, k, block, channels, end - start, previous, beforePrevious)
+        : (header >> 4) == 1
+        ? decodeBlock<1>(reader, k, block, channels, end - start, previous, beforePrevious)
+        : decodeBlock<2>(reader, k, block, channels, end - start, previous, beforePrevious);
+      if (!decoded) {
+        return false;
+      }
+    }
+  }
+  size_t consumedBits = reader.position * 8 - reader.count;
+  return (consumedBits + 7) / 8 == length && reader.window == 0;
+}
@@ -0,0 +1,374 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : EmgFrame.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Binary EMG streaming frame encoder/decoder Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "EmgFrame.h"
+#include "EmgCodec.h"
+#include <string.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+// CRC-16/CCITT-FALSE lookup table (polynomial 0x1021)
+static const uint16_t crcTable[256] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+  0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+  0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+  0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+  0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+  0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+  0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+  0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+  0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+  0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+  0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+  0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+  0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+  0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+  0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+  0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+  0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+  0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+  0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+  0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+  0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+  0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+  0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+  0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+  0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+  0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+  0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+  0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+  0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+  0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+  0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Helpers                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+static void putLe16(uint8_t* out, uint16_t value) {
+  out[0] = (uint8_t)value;
+  out[1] = (uint8_t)(value >> 8);
+}
+
+static void putLe32(uint8_t* out, uint32_t value) {
+  putLe16(out, (uint16_t)value);
+  putLe16(out + 2, (uint16_t)(value >> 16));
+}
+
+static uint16_t getLe16(const uint8_t* in) {
+  return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t getLe32(const uint8_t* in) {
+  return getLe16(in) | ((uint32_t)getLe16(in + 2) << 16);
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* EmgFrame                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Build a complete wire frame
+  * @param      header Frame header, version is forced to EMG_FRAME_VERSION
+  * @param      samples 12-bit samples, header.sampleCount of them
+  * @param      out Output buffer, EMG_FRAME_ENCODED_BYTES(sampleCount) bytes are enough
+  * @param      outSize Size of the output buffer
+  * @param      outLength Number of bytes to transmit, delimiter included
+  * @return     true if the frame was built
+  * @details    The raw frame is built one byte into out and COBS encoded in place, so samples
+  *             are packed once, straight into the frame that goes on the wire. A
+  *             EMG_FRAME_TYPE_RICE frame that would not be smaller than the packed one is sent
+  *             packed, as EMG_FRAME_TYPE_SAMPLES.
+  ********************************************************************************************** */
+bool EmgFrame::encode(const EmgFrameHeader& header, const uint16_t* samples,
+                      uint8_t* out, size_t outSize, size_t& outLength) {
+  if (samples == nullptr || out == nullptr || header.sampleCount > EMG_FRAME_MAX_SAMPLES ||
+      outSize < (size_t)EMG_FRAME_ENCODED_BYTES(header.sampleCount)) {
+    return false;
+  }
+
+  uint8_t* raw = out + 1;
+  raw[0] = EMG_FRAME_VERSION;
+  raw[1] = header.type;
+  raw[2] = header.label;
+  raw[3] = header.channels;
+  putLe16(&raw[4], header.sequence);
+  putLe32(&raw[6], header.timestampUs);
+  putLe16(&raw[10], header.sampleCount);
+  size_t length = EMG_FRAME_HEADER_BYTES;
+  size_t payloadLength = 0;
+  if (header.type == EMG_FRAME_TYPE_RICE &&
+      EmgCodec::encode(samples, header.sampleCount, header.channels, &raw[length],
+                       EMG_FRAME_PAYLOAD_BYTES(header.sampleCount), payloadLength) &&
+      payloadLength < (size_t)EMG_FRAME_PAYLOAD_BYTES(header.sampleCount)) {
+    length += payloadLength;
+  } else {
+    raw[1] = header.type == EMG_FRAME_TYPE_RICE ? EMG_FRAME_TYPE_SAMPLES : header.type;
+    length += packSamples(samples, header.sampleCount, &raw[length]);
+  }
+  putLe16(&raw[length], crc16(raw, length));
+  length += EMG_FRAME_CRC_BYTES;
+
+  outLength = cobsEncodeInPlace(out, length);
+  out[outLength++] = EMG_FRAME_DELIMITER;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Validate and decode one frame
+  * @param      frame COBS encoded frame without its delimiter
+  * @param      length Length of the encoded frame
+  * @param      header Decoded header
+  * @param      samples Decoded 12-bit samples
+  * @param      maxSamples Capacity of samples
+  * @return     true if the frame is well formed, has a valid CRC and fits in samples
+  ********************************************************************************************** */
+bool EmgFrame::decode(const uint8_t* frame, size_t length,
+                      EmgFrameHeader& header, uint16_t* samples, size_t maxSamples) {
+  if (frame == nullptr || samples == nullptr || length > EMG_FRAME_MAX_ENCODED_BYTES) {
+    return false;
+  }
+
+  uint8_t raw[EMG_FRAME_MAX_ENCODED_BYTES];
+  size_t rawLength = cobsDecode(frame, length, raw);
+  if (rawLength < EMG_FRAME_HEADER_BYTES + EMG_FRAME_CRC_BYTES) {
+    return false;
+  }
+  size_t crcOffset = rawLength - EMG_FRAME_CRC_BYTES;
+  if (crc16(raw, crcOffset) != getLe16(&raw[crcOffset]) || raw[0] != EMG_FRAME_VERSION) {
+    return false;
+  }
+
+  header.version = raw[0];
+  header.type = raw[1];
+  header.label = raw[2];
+  header.channels = raw[3];
+  header.sequence = getLe16(&raw[4]);
+  header.timestampUs = getLe32(&raw[6]);
+  header.sampleCount = getLe16(&raw[10]);
+  if (header.sampleCount > maxSamples) {
+    return false;
+  }
+  if (header.type == EMG_FRAME_TYPE_RICE) {
+    return EmgCodec::decode(&raw[EMG_FRAME_HEADER_BYTES], crcOffset - EMG_FRAME_HEADER_BYTES,
+                            header.channels, samples, header.sampleCount);
+  }
+  if (rawLength != (size_t)EMG_FRAME_RAW_BYTES(header.sampleCount)) {
+    return false;
+  }
+  unpackSamples(&raw[EMG_FRAME_HEADER_BYTES], header.sampleCount, samples);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Pack 12-bit samples, two samples in three bytes
+  * @param      samples Samples, only the low 12 bits are kept
+  * @param      count Number of samples
+  * @param      out Packed output, EMG_FRAME_PAYLOAD_BYTES(count) bytes
+  * @return     Number of bytes written
+  ********************************************************************************************** */
+size_t EmgFrame::packSamples(const uint16_t* samples, size_t count, uint8_t* out) {
+  size_t length = 0;
+  size_t i = 0;
+  for (; i + 1 < count; i += 2) {
+    uint16_t a = samples[i] & 0x0FFF;
+    uint16_t b = samples[i + 1] & 0x0FFF;
+    out[length++] = (uint8_t)a;
+    out[length++] = (uint8_t)((a >> 8) | (b << 4));
+    out[length++] = (uint8_t)(b >> 4);
+  }
+  if (i < count) {
+    out[length++] = (uint8_t)samples[i];
+    out[length++] = (uint8_t)((samples[i] >> 8) & 0x0F);
+  }
+  return length;
+}
+
+/**************************************************************************************************
+  * @brief      Unpack samples produced by packSamples()
+  * @param      packed Packed input
+  * @param      count Number of samples to unpack
+  * @param      samples Output samples
+  * @return     Nothing
+  ********************************************************************************************** */
+void EmgFrame::unpackSamples(const uint8_t* packed, size_t count, uint16_t* samples) {
+  size_t i = 0;
+  for (; i + 1 < count; i += 2, packed += 3) {
+    samples[i] = (uint16_t)(packed[0] | ((packed[1] & 0x0F) << 8));
+    samples[i + 1] = (uint16_t)((packed[1] >> 4) | (packed[2] << 4));
+  }
+  if (i < count) {
+    samples[i] = (uint16_t)(packed[0] | ((packed[1] & 0x0F) << 8));
+  }
+}
+
+/**************************************************************************************************
+  * @brief      CRC-16/CCITT-FALSE
+  * @param      data Input bytes
+  * @param      length Number of bytes
+  * @param      crc Initial value, pass a previous result to continue a computation
+  * @return     CRC value
+  ********************************************************************************************** */
+uint16_t EmgFrame::crc16(const uint8_t* data, size_t length, uint16_t crc) {
+  for (size_t i = 0; i < length; i++) {
+    crc = (uint16_t)((crc << 8) ^ crcTable[(uint8_t)(crc >> 8) ^ data[i]]);
+  }
+  return crc;
+}
+
+/**************************************************************************************************
+  * @brief      Consistent Overhead Byte Stuffing encoder
+  * @param      in Input bytes
+  * @param      length Number of input bytes
+  * @param      out Output, at least length + length / 254 + 1 bytes, never contains 0x00
+  * @return     Number of bytes written
+  ********************************************************************************************** */
+size_t EmgFrame::cobsEncode(const uint8_t* in, size_t length, uint8_t* out) {
+  size_t write = 1;
+  size_t codeIndex = 0;
+  uint8_t code = 1;
+  for (size_t read = 0; read < length; read++) {
+    if (in[read] == 0) {
+      out[codeIndex] = code;
+      code = 1;
+      codeIndex = write++;
+    } else {
+      out[write++] = in[read];
+      if (++code == 0xFF) {
+        out[codeIndex] = code;
+        code = 1;
+        codeIndex = write++;
+      }
+    }
+  }
+  out[codeIndex] = code;
+  return write;
+}
+
+/**************************************************************************************************
+  * @brief      Consistent Overhead Byte Stuffing encoder working in place
+  * @param      buffer Input in buffer[1 .. length], buffer[0] is free for the first code byte.
+  *             Holds length + length / 254 + 1 bytes
+  * @param      length Number of input bytes
+  * @return     Number of encoded bytes, same output as cobsEncode()
+  * @details    Each code byte takes the place of the zero that ends its block, so the data
+  *             does not move. Only a block of 254 non-zero bytes needs an extra code byte and
+  *             shifts the rest of the input by one.
+  ********************************************************************************************** */
+size_t EmgFrame::cobsEncodeInPlace(uint8_t* buffer, size_t length) {
+  size_t end = length + 1;
+  size_t codeIndex = 0;
+  uint8_t code = 1;
+  for (size_t read = 1; read < end; read++) {
+    if (buffer[read] == 0) {
+      buffer[codeIndex] = code;
+      code = 1;
+      codeIndex = read;
+    } else if (++code == 0xFF) {
+      buffer[codeIndex] = code;
+      code = 1;
+      codeIndex = ++read;
+      memmove(&buffer[read + 1], &buffer[read], end - read);
+      end++;
+    }
+  }
+  buffer[codeIndex] = code;
+  return end;
+}
+
+/**************************************************************************************************
+  * @brief      Consistent Overhead Byte Stuffing decoder
+  * @param      in Encoded bytes, without delimiter
+  * @param      length Number of encoded bytes
+  * @param      out Output, at least length bytes
+  * @return     Number of decoded bytes, 0 if the input is malformed
+  ********************************************************************************************** */
+size_t EmgFrame::cobsDecode(const uint8_t* in, size_t length, uint8_t* out) {
+  size_t read = 0;
+  size_t write = 0;
+  while (read < length) {
+    uint8_t code = in[read];
+    if (code == 0 || read + code > length) {
+      return 0;
+    }
+    read++;
+    for (uint8_t i = 1; i < code; i++) {
+      if (in[read] == 0) {
+        return 0;
+      }
+      out[write++] = in[read++];
+    }
+    if (code != 0xFF && read != length) {
+      out[write++] = 0;
+    }
+  }
+  return write;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* EmgFrameReceiver                                                                              */
+/*-----------------------------------------------------------------------------------------------*/
+EmgFrameReceiver::EmgFrameReceiver() {
+  this->fill = 0;
+  this->frameLength = 0;
+  this->discarding = false;
+  this->overflowCount = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Feed one received byte
+  * @param      byte Received byte
+  * @return     true if a complete frame is available through frame() and length()
+  * @details    The returned frame stays valid until the next call to push().
+  ********************************************************************************************** */
+bool EmgFrameReceiver::push(uint8_t byte) {
+  if (byte == EMG_FRAME_DELIMITER) {
+    bool complete = !this->discarding && this->fill > 0;
+    this->frameLength = complete ? this->fill : 0;
+    this->fill = 0;
+    this->discarding = false;
+    return complete;
+  }
+  if (this->discarding) {
+    return false;
+  }
+  if (this->fill == sizeof(this->buffer)) {
+    this->discarding = true;
+    this->overflowCount++;
+    return false;
+  }
+  this->buffer[this->fill++] = byte;
+  return false;
+}
+
+const uint8_t* EmgFrameReceiver::frame() const {
+  return this->buffer;
+}
+
+size_t EmgFrameReceiver::length() const {
+  return this->frameLength;
+}
+
+uint32_t EmgFrameReceiver::overflows() const {
+  return this->overflowCount;
+}
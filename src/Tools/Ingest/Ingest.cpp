@@ -0,0 +1,609 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Ingest.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host daemon receiving DatasetGeneration streams from several ports at once
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Usage: ingest [options] port...
+ *
+ *   --baud N       Configure serial ports to N baud, raw mode (ports that are not ttys ignore it)
+ *   --workers N    Decode threads (2)
+ *   --label L      Only accept frames carrying this gesture label
+ *   --stats S      Print the counters every S seconds
+ *   --format F     columnar: EmgDataset files PREFIX-<port index>.emgc (default)
+ *                  capture: valid frames as received, PREFIX-<port index>.bin
+ *   --channels N   Channels per scan expected in the frames (1)
+ *   --rate N       Scan rate in Hz recorded in the dataset header (1000)
+ *   --session N    Session id stored in the dataset index (0)
+ *   --subject N    Subject id stored in the dataset index (0)
+ *   -o PREFIX      Output prefix (capture)
+ *
+ * A port is a serial device, a pty, a fifo, a file or - for stdin. The pipeline is:
+ *
+ *   reader thread per port -> decode pool -> writer thread
+ *
+ * Readers only split the byte stream on frame delimiters and copy each frame into a slot of a
+ * preallocated pool, so they drain the kernel buffer at any line rate. Workers COBS decode the
+ * frames and check the CRC, version, type and label. The writer restores the arrival order of
+ * each port, counts lost frames from sequence gaps and appends every valid frame to the
+ * output of its port: a columnar EmgDataset, or the frames still encoded as the device sent
+ * them. Both are readable by modelTrainer.
+ *
+ * No allocation happens after start-up. When the pool runs out of slots, the reader of a live
+ * port (tty or pty) drops the frame and counts it as an overflow instead of blocking, while
+ * files and fifos wait for the writer and are ingested losslessly. Runs until every port
+ * reached end of file or hung up, or until SIGINT/SIGTERM.
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "EmgDataset.h"
+#include "EmgFrame.h"
+#include "GestureClassifier.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+const size_t readChunkBytes = 4096;
+const uint32_t slotCount = 4096;         // Frames in flight across all ports
+const size_t slotBatch = 64;             // Slots moved per queue operation
+const int pollTimeoutMs = 200;           // Bounds the reaction time to a stop request
+const size_t outputBufferBytes = 1 << 20;
+const int32_t recordingMidScale = 2048;  // DatasetGeneration records around EMG_ADC_MIDSCALE
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct IngestOptions {
+  unsigned baud = 0;
+  unsigned workers = 2;
+  int label = -1;
+  double statsSeconds = 0.0;
+  bool columnar = true;
+  unsigned channels = 1;
+  unsigned rate = 1000;
+  unsigned session = 0;
+  unsigned subject = 0;
+  const char* output = "capture";
+};
+
+struct FrameSlot {
+  uint32_t port;
+  uint64_t arrival;           // Frame index on its port, restores the order after the pool
+  size_t length;
+  bool valid;
+  EmgFrameHeader header;
+  uint8_t encoded[EMG_FRAME_MAX_ENCODED_BYTES];
+  uint16_t samples[EMG_FRAME_MAX_SAMPLES];
+  int16_t centred[EMG_FRAME_MAX_SAMPLES];
+};
+
+struct PortCounters {
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> frames{0};       // Delimited frames
+  std::atomic<uint64_t> valid{0};        // Written to the output
+  std::atomic<uint64_t> corrupt{0};      // Bad COBS, CRC, version, type, size or channels
+  std::atomic<uint64_t> wrongLabel{0};
+  std::atomic<uint64_t> lost{0};         // Sequence gaps, on the link or dropped here
+  std::atomic<uint64_t> overflows{0};    // Dropped here, no free slot
+};
+
+struct Port {
+  std::string path;
+  int fd = -1;
+  bool live = false;                     // Serial device or pty, the sender cannot be paused
+  FILE* output = nullptr;                // Capture format
+  EmgDatasetWriter dataset;              // Columnar format
+  PortCounters counters;
+  std::atomic<bool> done{false};
+  std::thread reader;
+
+  // Writer owned
+  std::vector<uint32_t> reorder;         // Slot + 1 by arrival modulo slotCount, 0 when empty
+  uint64_t nextArrival = 0;
+  uint16_t expectedSequence = 0;
+  bool synchronised = false;
+  uint32_t lastTimestampUs = 0;
+  uint64_t timestampWrapUs = 0;          // Unwraps the 32-bit frame timestamps
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Classes                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**
+ * Multi-producer multi-consumer queue of slot indices. It is sized for the whole pool, so push
+ * never blocks. pop blocks until items are available or the queue is closed and empty, popFor
+ * at most for a timeout so the caller can check for a stop request.
+ */
+class SlotQueue {
+
+public:
+  SlotQueue() : items(slotCount), head(0), count(0), closed(false) {}
+
+  void push(const uint32_t* slots, size_t n) {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      for (size_t i = 0; i < n; i++) {
+        this->items[(this->head + this->count + i) % slotCount] = slots[i];
+      }
+      this->count += n;
+    }
+    this->ready.notify_all();
+  }
+
+  size_t pop(uint32_t* slots, size_t maxCount, bool wait) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (wait) {
+      this->ready.wait(lock, [this] { return this->count > 0 || this->closed; });
+    }
+    return take(slots, maxCount);
+  }
+
+  size_t popFor(uint32_t* slots, size_t maxCount, int timeoutMs) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->ready.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                         [this] { return this->count > 0 || this->closed; });
+    return take(slots, maxCount);
+  }
+
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->closed = true;
+    }
+    this->ready.notify_all();
+  }
+
+private:
+  std::vector<uint32_t> items;
+  size_t head;
+  size_t count;
+  bool closed;
+  std::mutex mutex;
+  std::condition_variable ready;
+
+  // Caller holds the lock
+  size_t take(uint32_t* slots, size_t maxCount) {
+    size_t n = maxCount < this->count ? maxCount : this->count;
+    for (size_t i = 0; i < n; i++) {
+      slots[i] = this->items[(this->head + i) % slotCount];
+    }
+    this->head = (this->head + n) % slotCount;
+    this->count -= n;
+    return n;
+  }
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Globals                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+static std::atomic<bool> stopRequested(false);
+static IngestOptions options;
+static std::vector<std::unique_ptr<Port>> ports;
+static std::unique_ptr<FrameSlot[]> slots;
+static SlotQueue freeSlots;
+static SlotQueue decodeQueue;
+static SlotQueue writeQueue;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Helpers                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+static void onSignal(int) {
+  stopRequested.store(true);
+}
+
+/**************************************************************************************************
+  * @brief      Termios constant of a baud rate
+  * @return     Speed constant, B0 if the rate is not supported
+  ********************************************************************************************** */
+static speed_t baudConstant(unsigned baud) {
+  switch (baud) {
+    case 115200: return B115200;
+    case 230400: return B230400;
+#ifdef B460800
+    case 460800: return B460800;
+#endif
+#ifdef B921600
+    case 921600: return B921600;
+#endif
+#ifdef B1000000
+    case 1000000: return B1000000;
+#endif
+#ifdef B2000000
+    case 2000000: return B2000000;
+#endif
+#ifdef B3000000
+    case 3000000: return B3000000;
+#endif
+    default: return B0;
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Open a port for reading, raw mode for ttys
+  * @return     true if the port is ready
+  ********************************************************************************************** */
+static bool openPort(Port& port) {
+  port.fd = port.path == "-" ? STDIN_FILENO : open(port.path.c_str(), O_RDONLY | O_NOCTTY);
+  if (port.fd < 0) {
+    fprintf(stderr, "ingest: cannot open %s: %s\n", port.path.c_str(), strerror(errno));
+    return false;
+  }
+  port.live = isatty(port.fd);
+  if (port.live) {
+    struct termios tty;
+    if (tcgetattr(port.fd, &tty) != 0) {
+      return false;
+    }
+    cfmakeraw(&tty);
+    tty.c_cc[VMIN] = 0;
+    tty.c_cc[VTIME] = 0;
+    if (options.baud != 0) {
+      speed_t speed = baudConstant(options.baud);
+      if (speed == B0) {
+        fprintf(stderr, "ingest: unsupported baud rate %u\n", options.baud);
+        return false;
+      }
+      cfsetispeed(&tty, speed);
+      cfsetospeed(&tty, speed);
+    }
+    if (tcsetattr(port.fd, TCSANOW, &tty) != 0) {
+      fprintf(stderr, "ingest: cannot configure %s: %s\n", port.path.c_str(), strerror(errno));
+      return false;
+    }
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Reader thread: delimit frames and hand them to the decode pool
+  * @return     Nothing
+  * @details    Frames are forwarded once per read() so the queue lock is taken per chunk, not
+  *             per frame. Free slots are taken in batches for the same reason. Before waiting
+  *             for free slots a reader forwards the frames it holds: otherwise readers of
+  *             files could hold the whole pool between them and wait for each other forever.
+  *             The wait is bounded by pollTimeoutMs so a stop request is still seen.
+  ********************************************************************************************** */
+static void readPort(uint32_t index) {
+  Port& port = *ports[index];
+  EmgFrameReceiver receiver;
+  uint8_t chunk[readChunkBytes];
+  uint32_t spare[slotBatch];
+  size_t spareCount = 0;
+  uint32_t filled[readChunkBytes];
+  uint64_t arrival = 0;
+  uint32_t receiverOverflows = 0;
+  while (!stopRequested.load()) {
+    struct pollfd fd = { port.fd, POLLIN, 0 };
+    int ready = poll(&fd, 1, pollTimeoutMs);
+    if (ready < 0 && errno != EINTR) {
+      break;
+    }
+    if (ready <= 0) {
+      continue;
+    }
+    ssize_t received = read(port.fd, chunk, sizeof(chunk));
+    if (received < 0 && (errno == EINTR || errno == EAGAIN)) {
+      continue;
+    }
+    if (received <= 0) {
+      break;   // End of file, or EIO once the other side of a pty closed
+    }
+    port.counters.bytes.fetch_add((uint64_t)received, std::memory_order_relaxed);
+    size_t filledCount = 0;
+    for (ssize_t i = 0; i < received; i++) {
+      if (!receiver.push(chunk[i])) {
+        continue;
+      }
+      port.counters.frames.fetch_add(1, std::memory_order_relaxed);
+      if (spareCount == 0) {
+        spareCount = freeSlots.pop(spare, slotBatch, false);
+      }
+      if (spareCount == 0 && !port.live) {
+        // Files never lose frames to a full pipeline, they wait for the writer instead
+        if (filledCount > 0) {
+          decodeQueue.push(filled, filledCount);
+          filledCount = 0;
+        }
+        while (spareCount == 0 && !stopRequested.load()) {
+          spareCount = freeSlots.popFor(spare, slotBatch, pollTimeoutMs);
+        }
+      }
+      if (spareCount == 0) {
+        port.counters.overflows.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      uint32_t id = spare[--spareCount];
+      FrameSlot& slot = slots[id];
+      slot.port = index;
+      slot.arrival = arrival++;
+      slot.length = receiver.length();
+      memcpy(slot.encoded, receiver.frame(), slot.length);
+      filled[filledCount++] = id;
+    }
+    if (receiver.overflows() != receiverOverflows) {
+      port.counters.corrupt.fetch_add(receiver.overflows() - receiverOverflows,
+                                      std::memory_order_relaxed);
+      receiverOverflows = receiver.overflows();
+    }
+    if (filledCount > 0) {
+      decodeQueue.push(filled, filledCount);
+    }
+  }
+  if (spareCount > 0) {
+    freeSlots.push(spare, spareCount);
+  }
+  port.done.store(true);
+}
+
+/**************************************************************************************************
+  * @brief      Decode thread: validate frames
+  * @return     Nothing
+  ********************************************************************************************** */
+static void decodeFrames() {
+  uint32_t batch[slotBatch];
+  size_t count;
+  while ((count = decodeQueue.pop(batch, slotBatch, true)) > 0) {
+    for (size_t i = 0; i < count; i++) {
+      FrameSlot& slot = slots[batch[i]];
+      PortCounters& counters = ports[slot.port]->counters;
+      slot.valid = EmgFrame::decode(slot.encoded, slot.length, slot.header, slot.samples,
+                                    EMG_FRAME_MAX_SAMPLES) &&
+                   EMG_FRAME_HAS_SAMPLES(slot.header.type) &&
+                   slot.header.channels == options.channels &&
+                   slot.header.sampleCount % slot.header.channels == 0;
+      if (!slot.valid) {
+        counters.corrupt.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      bool labelOk = options.label >= 0 ? slot.header.label == options.label
+                                        : slot.header.label < GESTURE_MAX_CLASSES;
+      if (!labelOk) {
+        slot.valid = false;
+        counters.wrongLabel.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      for (uint16_t s = 0; s < slot.header.sampleCount; s++) {
+        slot.centred[s] = (int16_t)(slot.samples[s] - recordingMidScale);
+      }
+    }
+    writeQueue.push(batch, count);
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Account for and store one frame, in arrival order
+  * @return     Nothing
+  ********************************************************************************************** */
+static void writeFrame(Port& port, const FrameSlot& slot) {
+  if (!slot.valid) {
+    return;
+  }
+  if (port.synchronised && slot.header.sequence != port.expectedSequence) {
+    port.counters.lost.fetch_add((uint16_t)(slot.header.sequence - port.expectedSequence),
+                                 std::memory_order_relaxed);
+  }
+  port.synchronised = true;
+  port.expectedSequence = (uint16_t)(slot.header.sequence + 1);
+  if (slot.header.timestampUs < port.lastTimestampUs) {
+    port.timestampWrapUs += 1ULL << 32;
+  }
+  port.lastTimestampUs = slot.header.timestampUs;
+  if (options.columnar) {
+    port.dataset.append(slot.header.label, options.session, options.subject,
+                        port.timestampWrapUs + slot.header.timestampUs, slot.centred,
+                        slot.header.sampleCount);
+  } else {
+    static const uint8_t delimiter = EMG_FRAME_DELIMITER;
+    fwrite(slot.encoded, 1, slot.length, port.output);
+    fwrite(&delimiter, 1, 1, port.output);
+  }
+  port.counters.valid.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**************************************************************************************************
+  * @brief      Writer thread: restore the order of each port and write the valid frames
+  * @return     Nothing
+  ********************************************************************************************** */
+static void writeFrames() {
+  uint32_t batch[slotBatch];
+  uint32_t released[slotBatch];
+  size_t count;
+  while ((count = writeQueue.pop(batch, slotBatch, true)) > 0) {
+    size_t releasedCount = 0;
+    for (size_t i = 0; i < count; i++) {
+      const FrameSlot& arrived = slots[batch[i]];
+      Port& port = *ports[arrived.port];
+      port.reorder[arrived.arrival % slotCount] = batch[i] + 1;
+      uint32_t* next;
+      while (*(next = &port.reorder[port.nextArrival % slotCount]) != 0) {
+        uint32_t id = *next - 1;
+        *next = 0;
+        port.nextArrival++;
+        writeFrame(port, slots[id]);
+        released[releasedCount++] = id;
+        if (releasedCount == slotBatch) {
+          freeSlots.push(released, releasedCount);
+          releasedCount = 0;
+        }
+      }
+    }
+    if (releasedCount > 0) {
+      freeSlots.push(released, releasedCount);
+    }
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Print the counters of every port
+  * @return     Nothing
+  ********************************************************************************************** */
+static void printCounters(double seconds) {
+  for (size_t i = 0; i < ports.size(); i++) {
+    const PortCounters& c = ports[i]->counters;
+    uint64_t bytes = c.bytes.load();
+    fprintf(stderr, "%s: %llu bytes (%.0f baud equivalent), %llu frames, %llu valid, %llu corrupt, "
+                    "%llu wrong label, %llu lost, %llu overflows\n",
+            ports[i]->path.c_str(), (unsigned long long)bytes,
+            seconds > 0.0 ? bytes * 10.0 / seconds : 0.0, (unsigned long long)c.frames.load(),
+            (unsigned long long)c.valid.load(), (unsigned long long)c.corrupt.load(),
+            (unsigned long long)c.wrongLabel.load(), (unsigned long long)c.lost.load(),
+            (unsigned long long)c.overflows.load());
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Main                                                                                          */
+/*-----------------------------------------------------------------------------------------------*/
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--baud" && hasValue) {
+      options.baud = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--workers" && hasValue) {
+      options.workers = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--label" && hasValue) {
+      options.label = atoi(argv[++i]);
+    } else if (arg == "--stats" && hasValue) {
+      options.statsSeconds = atof(argv[++i]);
+    } else if (arg == "--format" && hasValue) {
+      std::string format = argv[++i];
+      if (format != "columnar" && format != "capture") {
+        fprintf(stderr, "ingest: unknown format %s\n", format.c_str());
+        return EXIT_FAILURE;
+      }
+      options.columnar = format == "columnar";
+    } else if (arg == "--channels" && hasValue) {
+      options.channels = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--rate" && hasValue) {
+      options.rate = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--session" && hasValue) {
+      options.session = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--subject" && hasValue) {
+      options.subject = (unsigned)atoi(argv[++i]);
+    } else if (arg == "-o" && hasValue) {
+      options.output = argv[++i];
+    } else if (arg[0] == '-' && arg != "-") {
+      fprintf(stderr, "ingest: unknown option %s\n", arg.c_str());
+      return EXIT_FAILURE;
+    } else {
+      ports.emplace_back(new Port());
+      ports.back()->path = arg;
+    }
+  }
+  if (ports.empty() || options.workers == 0 || options.channels == 0 ||
+      options.channels > EMG_DATASET_MAX_CHANNELS || options.rate == 0) {
+    fprintf(stderr, "usage: ingest [--baud N] [--workers N] [--label L] [--stats S] "
+                    "[--format columnar|capture] [--channels N] [--rate N] [--session N] "
+                    "[--subject N] [-o prefix] port...\n");
+    return EXIT_FAILURE;
+  }
+
+  slots.reset(new FrameSlot[slotCount]);
+  for (uint32_t id = 0; id < slotCount; id++) {
+    freeSlots.push(&id, 1);
+  }
+  for (size_t i = 0; i < ports.size(); i++) {
+    Port& port = *ports[i];
+    std::string path = std::string(options.output) + "-" + std::to_string(i) +
+                       (options.columnar ? ".emgc" : ".bin");
+    bool created;
+    if (options.columnar) {
+      created = port.dataset.open(path.c_str(), (uint16_t)options.channels, options.rate);
+    } else {
+      port.output = fopen(path.c_str(), "wb");
+      created = port.output != nullptr &&
+                setvbuf(port.output, nullptr, _IOFBF, outputBufferBytes) == 0;
+    }
+    if (!created) {
+      fprintf(stderr, "ingest: cannot create %s\n", path.c_str());
+      return EXIT_FAILURE;
+    }
+    port.reorder.assign(slotCount, 0);
+    if (!openPort(port)) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < options.workers; i++) {
+    workers.emplace_back(decodeFrames);
+  }
+  std::thread writer(writeFrames);
+  for (uint32_t i = 0; i < ports.size(); i++) {
+    ports[i]->reader = std::thread(readPort, i);
+  }
+
+  // Report while the readers run
+  auto lastReport = start;
+  bool running = true;
+  while (running) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    running = false;
+    for (const std::unique_ptr<Port>& port : ports) {
+      running |= !port->done.load();
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (options.statsSeconds > 0.0 &&
+        std::chrono::duration<double>(now - lastReport).count() >= options.statsSeconds) {
+      printCounters(std::chrono::duration<double>(now - start).count());
+      lastReport = now;
+    }
+  }
+
+  // Drain the pipeline stage by stage
+  for (const std::unique_ptr<Port>& port : ports) {
+    port->reader.join();
+  }
+  decodeQueue.close();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  writeQueue.close();
+  writer.join();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  bool success = true;
+  for (const std::unique_ptr<Port>& port : ports) {
+    success &= options.columnar ? port->dataset.close() : fclose(port->output) == 0;
+    if (port->fd != STDIN_FILENO) {
+      close(port->fd);
+    }
+  }
+  printCounters(seconds);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,554 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : ModelTrainer.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host tool training the gesture classifier from DatasetGeneration recordings
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ * Usage: modelTrainer [options] -o GestureModelData.h recording...
+ *
+ *   --mlp N        Train a one hidden layer MLP with N units instead of an LDA
+ *   --label L      Override the frame label for the following recordings
+ *   --window N     Feature window in samples   (EMG_WINDOW)
+ *   --hop N        Feature hop in samples      (EMG_HOP)
+ *   --threshold N  ZC/SSC dead band            (EMG_DEAD_BAND)
+ *   --min-rms N    Ignore windows below this RMS, the arm does not classify them either
+ *                  (EMG_ACTIVATION_RMS)
+ *
+ * A recording is the raw serial capture of the DatasetGeneration application, or an EmgDataset
+ * file written by the ingest tool. Frames are decoded with EmgFrame, datasets are mapped and
+ * read in place. Features are computed with the same EmgFeatures code as the arm and the frame
+ * or segment label is the gesture id. The model is quantized and written as a C++ header.
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "EmgDataset.h"
+#include "EmgFrame.h"
+#include "EmgFeatures.h"
+#include "GestureClassifier.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+const int32_t recordingMidScale = 2048;  // DatasetGeneration records around EMG_ADC_MIDSCALE
+const int mlpEpochs = 300;
+const double mlpLearningRate = 0.05;
+const double ldaRidge = 1e-3;            // Keeps the covariance invertible
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Types                                                                                         */
+/*-----------------------------------------------------------------------------------------------*/
+struct TrainerOptions {
+  unsigned hidden = 0;
+  unsigned window = 200;
+  unsigned hop = 50;
+  unsigned threshold = 20;
+  unsigned minRms = 200;
+  const char* output = nullptr;
+};
+
+struct Window {
+  double x[EMG_FEATURES_COUNT];   // Features in int8 input units, clamped like on target
+  EmgFeatureVector features;
+  uint8_t label;
+};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Helpers                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Extract the feature windows of one recording
+  * @return     true if the file could be read
+  * @details    The feature history restarts on sequence gaps so no window spans lost frames.
+  ********************************************************************************************** */
+static bool readRecording(const char* path, int labelOverride, const TrainerOptions& options,
+                          std::vector<Window>& windows) {
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "modelTrainer: cannot open %s\n", path);
+    return false;
+  }
+  EmgFrameReceiver receiver;
+  EmgFeatures extractor((uint16_t)options.window, (uint16_t)options.hop,
+                        (uint16_t)options.threshold);
+  EmgFrameHeader header;
+  uint16_t samples[EMG_FRAME_MAX_SAMPLES];
+  bool first = true;
+  uint16_t expected = 0;
+  int byte;
+  while ((byte = fgetc(file)) != EOF) {
+    if (!receiver.push((uint8_t)byte) ||
+        !EmgFrame::decode(receiver.frame(), receiver.length(), header, samples,
+                          EMG_FRAME_MAX_SAMPLES) ||
+        !EMG_FRAME_HAS_SAMPLES(header.type) || header.channels != 1) {
+      continue;
+    }
+    if (!first && header.sequence != expected) {
+      extractor.reset();
+    }
+    first = false;
+    expected = (uint16_t)(header.sequence + 1);
+    int label = labelOverride >= 0 ? labelOverride : header.label;
+    if (label >= GESTURE_MAX_CLASSES) {
+      continue;
+    }
+    for (uint16_t i = 0; i < header.sampleCount; i++) {
+      Window window;
+      if (extractor.push((int16_t)(samples[i] - recordingMidScale), window.features) &&
+          window.features.rms >= options.minRms) {
+        window.label = (uint8_t)label;
+        windows.push_back(window);
+      }
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Extract the feature windows of one columnar dataset, channel 0 only
+  * @return     true if the file could be mapped
+  * @details    The feature history restarts when a segment does not follow the previous one in
+  *             time, so no window spans a gap or two sessions.
+  ********************************************************************************************** */
+static bool readDataset(const char* path, int labelOverride, const TrainerOptions& options,
+                        std::vector<Window>& windows) {
+  EmgDatasetReader dataset;
+  if (!dataset.open(path)) {
+    fprintf(stderr, "modelTrainer: %s is not a complete dataset\n", path);
+    return false;
+  }
+  EmgFeatures extractor((uint16_t)options.window, (uint16_t)options.hop,
+                        (uint16_t)options.threshold);
+  uint64_t expectedUs = 0;
+  for (uint64_t id = 0; id < dataset.getSegmentCount(); id++) {
+    EmgSegment segment;
+    if (!dataset.getSegment(id, segment)) {
+      fprintf(stderr, "modelTrainer: %s segment %llu is truncated\n", path,
+              (unsigned long long)id);
+      return false;
+    }
+    if (id == 0 || segment.startUs != expectedUs) {
+      extractor.reset();
+    }
+    expectedUs = segment.startUs +
+                 segment.labels.size * 1000000ULL / dataset.getSampleRateHz();
+    int label = labelOverride >= 0 ? labelOverride : segment.label;
+    if (label >= GESTURE_MAX_CLASSES) {
+      continue;
+    }
+    for (int16_t sample : segment.channels[0]) {
+      Window window;
+      if (extractor.push(sample, window.features) && window.features.rms >= options.minRms) {
+        window.label = (uint8_t)label;
+        windows.push_back(window);
+      }
+    }
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Feature by index, in GestureModel order
+  * @return     Feature value
+  ********************************************************************************************** */
+static double featureValue(const EmgFeatureVector& features, int index) {
+  switch (index) {
+    case 0: return features.rms;
+    case 1: return features.mav;
+    case 2: return features.wl;
+    case 3: return features.zc;
+    default: return features.ssc;
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Choose input offsets and shifts so that +-4 sigma fills the int8 range
+  * @return     Nothing
+  ********************************************************************************************** */
+static void chooseInputScaling(std::vector<Window>& windows, GestureModel& model) {
+  for (int f = 0; f < EMG_FEATURES_COUNT; f++) {
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    for (const Window& w : windows) {
+      double v = featureValue(w.features, f);
+      sum += v;
+      sumSquares += v * v;
+    }
+    double mean = sum / windows.size();
+    double sigma = sqrt(std::max(sumSquares / windows.size() - mean * mean, 1e-9));
+    uint8_t shift = 0;
+    while (shift < 30 && 4.0 * sigma > 127.0 * (double)(1L << shift)) {
+      shift++;
+    }
+    model.featureOffset[f] = (int32_t)lround(mean);
+    model.featureShift[f] = shift;
+    for (Window& w : windows) {
+      double v = featureValue(w.features, f);
+      w.x[f] = std::max(-128.0, std::min(127.0, (v - model.featureOffset[f]) / (1L << shift)));
+    }
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Round a weight to int8 for a given layer scale
+  * @return     Quantized weight
+  ********************************************************************************************** */
+static int8_t quantizeWeight(double value, double scale) {
+  return (int8_t)std::max(-127L, std::min(127L, lround(value / scale)));
+}
+
+/**************************************************************************************************
+  * @brief      Round a bias to the accumulator scale of its layer
+  * @return     Quantized bias
+  ********************************************************************************************** */
+static int32_t quantizeBias(double value, double scale) {
+  return (int32_t)std::max(-1e9, std::min(1e9, round(value / scale)));
+}
+
+/**************************************************************************************************
+  * @brief      Linear discriminant analysis with a shared covariance matrix
+  * @return     true if the model was trained
+  ********************************************************************************************** */
+static bool trainLda(const std::vector<Window>& windows, GestureModel& model) {
+  const int n = EMG_FEATURES_COUNT;
+  double mean[GESTURE_MAX_CLASSES][EMG_FEATURES_COUNT] = {};
+  size_t count[GESTURE_MAX_CLASSES] = {};
+  for (const Window& w : windows) {
+    count[w.label]++;
+    for (int f = 0; f < n; f++) {
+      mean[w.label][f] += w.x[f];
+    }
+  }
+  for (int k = 0; k < model.classes; k++) {
+    for (int f = 0; f < n && count[k] > 0; f++) {
+      mean[k][f] /= count[k];
+    }
+  }
+
+  // Pooled covariance, augmented with the identity for Gauss-Jordan inversion
+  double a[EMG_FEATURES_COUNT][2 * EMG_FEATURES_COUNT] = {};
+  for (const Window& w : windows) {
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        a[i][j] += (w.x[i] - mean[w.label][i]) * (w.x[j] - mean[w.label][j]) / windows.size();
+      }
+    }
+  }
+  for (int i = 0; i < n; i++) {
+    a[i][i] += ldaRidge;
+    a[i][n + i] = 1.0;
+  }
+  for (int c = 0; c < n; c++) {
+    int pivot = c;
+    for (int r = c + 1; r < n; r++) {
+      if (fabs(a[r][c]) > fabs(a[pivot][c])) {
+        pivot = r;
+      }
+    }
+    if (fabs(a[pivot][c]) < 1e-12) {
+      fprintf(stderr, "modelTrainer: singular covariance\n");
+      return false;
+    }
+    for (int j = 0; j < 2 * n; j++) {
+      std::swap(a[c][j], a[pivot][j]);
+    }
+    double p = a[c][c];
+    for (int j = 0; j < 2 * n; j++) {
+      a[c][j] /= p;
+    }
+    for (int r = 0; r < n; r++) {
+      if (r != c) {
+        double factor = a[r][c];
+        for (int j = 0; j < 2 * n; j++) {
+          a[r][j] -= factor * a[c][j];
+        }
+      }
+    }
+  }
+
+  // score_k = (S^-1 mu_k) . x - mu_k . S^-1 mu_k / 2 + ln(prior_k)
+  double weights[GESTURE_MAX_CLASSES][EMG_FEATURES_COUNT] = {};
+  double bias[GESTURE_MAX_CLASSES] = {};
+  double maxWeight = 1e-12;
+  for (int k = 0; k < model.classes; k++) {
+    if (count[k] == 0) {
+      continue;
+    }
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        weights[k][i] += a[i][n + j] * mean[k][j];
+      }
+      bias[k] -= 0.5 * weights[k][i] * mean[k][i];
+      maxWeight = std::max(maxWeight, fabs(weights[k][i]));
+    }
+    bias[k] += log((double)count[k] / windows.size());
+  }
+  double scale = maxWeight / 127.0;
+  model.hidden = 0;
+  for (int k = 0; k < model.classes; k++) {
+    for (int f = 0; f < n; f++) {
+      model.outputWeights[k][f] = quantizeWeight(weights[k][f], scale);
+    }
+    model.outputBias[k] = count[k] > 0 ? quantizeBias(bias[k], scale) : INT32_MIN / 2;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      One hidden layer ReLU network trained with softmax cross entropy and SGD
+  * @return     true if the model was trained
+  * @details    Training runs on x / 32 so the inputs are roughly unit scale, the factor is
+  *             folded into the quantized hidden weights.
+  ********************************************************************************************** */
+static bool trainMlp(const std::vector<Window>& windows, unsigned hidden, GestureModel& model) {
+  const int n = EMG_FEATURES_COUNT;
+  const int h = (int)hidden;
+  const int k = model.classes;
+  std::mt19937 random(1);
+  std::uniform_real_distribution<double> init(-1.0, 1.0);
+  std::vector<double> w1(h * n), b1(h, 0.0), w2(k * h), b2(k, 0.0);
+  for (double& w : w1) w = init(random) * sqrt(6.0 / n);
+  for (double& w : w2) w = init(random) * sqrt(6.0 / h);
+
+  std::vector<size_t> order(windows.size());
+  for (size_t i = 0; i < order.size(); i++) order[i] = i;
+  std::vector<double> z(n), a(h), o(k), dh(h);
+  for (int epoch = 0; epoch < mlpEpochs; epoch++) {
+    std::shuffle(order.begin(), order.end(), random);
+    for (size_t index : order) {
+      const Window& w = windows[index];
+      for (int i = 0; i < n; i++) z[i] = w.x[i] / 32.0;
+      for (int j = 0; j < h; j++) {
+        a[j] = b1[j];
+        for (int i = 0; i < n; i++) a[j] += w1[j * n + i] * z[i];
+        a[j] = std::max(0.0, a[j]);
+      }
+      double maxScore = -1e300;
+      for (int c = 0; c < k; c++) {
+        o[c] = b2[c];
+        for (int j = 0; j < h; j++) o[c] += w2[c * h + j] * a[j];
+        maxScore = std::max(maxScore, o[c]);
+      }
+      double total = 0.0;
+      for (int c = 0; c < k; c++) total += (o[c] = exp(o[c] - maxScore));
+      std::fill(dh.begin(), dh.end(), 0.0);
+      for (int c = 0; c < k; c++) {
+        double d = o[c] / total - (c == w.label ? 1.0 : 0.0);
+        for (int j = 0; j < h; j++) {
+          dh[j] += d * w2[c * h + j];
+          w2[c * h + j] -= mlpLearningRate * d * a[j];
+        }
+        b2[c] -= mlpLearningRate * d;
+      }
+      for (int j = 0; j < h; j++) {
+        if (a[j] <= 0.0) continue;
+        for (int i = 0; i < n; i++) w1[j * n + i] -= mlpLearningRate * dh[j] * z[i];
+        b1[j] -= mlpLearningRate * dh[j];
+      }
+    }
+  }
+
+  // Hidden layer on the raw int8 inputs, then the shift bringing activations back to int8
+  double maxW1 = 1e-12;
+  for (double w : w1) maxW1 = std::max(maxW1, fabs(w / 32.0));
+  double scale1 = maxW1 / 127.0;
+  model.hidden = (uint8_t)h;
+  for (int j = 0; j < h; j++) {
+    for (int i = 0; i < n; i++) model.hiddenWeights[j][i] = quantizeWeight(w1[j * n + i] / 32.0, scale1);
+    model.hiddenBias[j] = quantizeBias(b1[j], scale1);
+  }
+  model.hiddenShift = 0;
+  model.classes = (uint8_t)k;
+  GestureClassifier probe(model);
+  int32_t maxAcc = 1;
+  for (const Window& w : windows) {
+    int8_t x[EMG_FEATURES_COUNT];
+    probe.quantize(w.features, x);
+    for (int j = 0; j < h; j++) {
+      int32_t acc = model.hiddenBias[j];
+      for (int i = 0; i < n; i++) acc += model.hiddenWeights[j][i] * x[i];
+      maxAcc = std::max(maxAcc, acc);
+    }
+  }
+  while ((maxAcc >> model.hiddenShift) > 127) {
+    model.hiddenShift++;
+  }
+  double scaleHidden = scale1 * (double)(1L << model.hiddenShift);
+
+  double maxW2 = 1e-12;
+  for (double w : w2) maxW2 = std::max(maxW2, fabs(w));
+  double scale2 = maxW2 / 127.0;
+  for (int c = 0; c < k; c++) {
+    for (int j = 0; j < h; j++) model.outputWeights[c][j] = quantizeWeight(w2[c * h + j], scale2);
+    model.outputBias[c] = quantizeBias(b2[c], scale2 * scaleHidden);
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Write an int array initializer
+  * @return     Nothing
+  ********************************************************************************************** */
+template <typename T>
+static void writeArray(FILE* out, const T* values, int count) {
+  fprintf(out, "{");
+  for (int i = 0; i < count; i++) {
+    fprintf(out, "%s%ld", i ? ", " : "", (long)values[i]);
+  }
+  fprintf(out, "}");
+}
+
+/**************************************************************************************************
+  * @brief      Write the model as a header for GestureClassifier
+  * @return     true if the file was written
+  ********************************************************************************************** */
+static bool writeHeader(const TrainerOptions& options, const GestureModel& model,
+                        size_t windowCount, double accuracy) {
+  FILE* out = fopen(options.output, "w");
+  if (out == nullptr) {
+    fprintf(stderr, "modelTrainer: cannot write %s\n", options.output);
+    return false;
+  }
+  int inputs = model.hidden > 0 ? model.hidden : EMG_FEATURES_COUNT;
+  fprintf(out,
+    "/**\n"
+    " **************************************************************************************************\n"
+    " *\n"
+    " * @file    : GestureModelData.h\n"
+    " * @brief   : Gesture classifier model, generated by ModelTrainer, do not edit\n"
+    " *\n"
+    " **************************************************************************************************\n"
+    " *\n"
+    " * %s model, %u classes, trained on %zu windows, quantized training accuracy %.1f %%\n"
+    " *\n"
+    " */\n\n"
+    "#ifndef GESTURE_MODEL_DATA_H\n"
+    "#define GESTURE_MODEL_DATA_H\n\n"
+    "#include \"GestureClassifier.h\"\n\n"
+    "// Feature extraction the model was trained with\n"
+    "#define GESTURE_MODEL_WINDOW %u\n"
+    "#define GESTURE_MODEL_HOP %u\n"
+    "#define GESTURE_MODEL_THRESHOLD %u\n"
+    "#define GESTURE_MODEL_MIN_RMS %u\n\n"
+    "static const GestureModel gestureModel = {\n",
+    model.hidden > 0 ? "MLP" : "LDA", (unsigned)model.classes, windowCount, accuracy * 100.0,
+    options.window, options.hop, options.threshold, options.minRms);
+  fprintf(out, "  %u,  // classes\n  %u,  // hidden\n  ", (unsigned)model.classes,
+          (unsigned)model.hidden);
+  writeArray(out, model.featureOffset, EMG_FEATURES_COUNT);
+  fprintf(out, ",\n  ");
+  writeArray(out, model.featureShift, EMG_FEATURES_COUNT);
+  fprintf(out, ",\n  {");
+  for (int j = 0; j < model.hidden; j++) {
+    fprintf(out, "%s\n    ", j ? "," : "");
+    writeArray(out, model.hiddenWeights[j], EMG_FEATURES_COUNT);
+  }
+  fprintf(out, "%s},\n  ", model.hidden ? "\n  " : "");
+  writeArray(out, model.hiddenBias, model.hidden);
+  fprintf(out, ",\n  %u,  // hiddenShift\n  {", (unsigned)model.hiddenShift);
+  for (int k = 0; k < model.classes; k++) {
+    fprintf(out, "%s\n    ", k ? "," : "");
+    writeArray(out, model.outputWeights[k], inputs);
+  }
+  fprintf(out, "\n  },\n  ");
+  writeArray(out, model.outputBias, model.classes);
+  fprintf(out, "\n};\n\n#endif // GESTURE_MODEL_DATA_H\n");
+  fclose(out);
+  return true;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Entry point                                                                                   */
+/*-----------------------------------------------------------------------------------------------*/
+int main(int argc, char** argv) {
+  TrainerOptions options;
+  std::vector<Window> windows;
+  int label = -1;
+  size_t recordings = 0;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--mlp" && hasValue) {
+      options.hidden = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--label" && hasValue) {
+      label = atoi(argv[++i]);
+    } else if (arg == "--window" && hasValue) {
+      options.window = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--hop" && hasValue) {
+      options.hop = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--threshold" && hasValue) {
+      options.threshold = (unsigned)atoi(argv[++i]);
+    } else if (arg == "--min-rms" && hasValue) {
+      options.minRms = (unsigned)atoi(argv[++i]);
+    } else if (arg == "-o" && hasValue) {
+      options.output = argv[++i];
+    } else if (arg[0] == '-') {
+      fprintf(stderr, "modelTrainer: unknown option %s\n", arg.c_str());
+      return EXIT_FAILURE;
+    } else {
+      bool read = EmgDatasetReader::isDataset(argv[i])
+                    ? readDataset(argv[i], label, options, windows)
+                    : readRecording(argv[i], label, options, windows);
+      if (!read) {
+        return EXIT_FAILURE;
+      }
+      recordings++;
+    }
+  }
+  if (options.output == nullptr || recordings == 0 || options.hidden > GESTURE_MAX_HIDDEN) {
+    fprintf(stderr, "usage: modelTrainer [--mlp N<=%d] [--label L] [--window N] [--hop N] "
+                    "[--threshold N] [--min-rms N] -o header recording...\n", GESTURE_MAX_HIDDEN);
+    return EXIT_FAILURE;
+  }
+  if (windows.empty()) {
+    fprintf(stderr, "modelTrainer: no active window in the recordings\n");
+    return EXIT_FAILURE;
+  }
+
+  static GestureModel model;
+  memset(&model, 0, sizeof(model));
+  for (const Window& w : windows) {
+    model.classes = std::max<uint8_t>(model.classes, (uint8_t)(w.label + 1));
+  }
+  chooseInputScaling(windows, model);
+  bool trained = options.hidden > 0 ? trainMlp(windows, options.hidden, model)
+                                    : trainLda(windows, model);
+  if (!trained) {
+    return EXIT_FAILURE;
+  }
+
+  // Accuracy of the quantized model, exactly as the arm will evaluate it
+  GestureClassifier classifier(model);
+  size_t correct = 0;
+  for (const Window& w : windows) {
+    uint8_t gesture;
+    correct += (classifier.classify(w.features, gesture) && gesture == w.label);
+  }
+  double accuracy = (double)correct / windows.size();
+  printf("%s model: %u classes, %zu windows from %zu recordings, accuracy %.1f %%\n",
+         options.hidden > 0 ? "MLP" : "LDA", (unsigned)model.classes, windows.size(), recordings,
+         accuracy * 100.0);
+  return writeHeader(options, model, windows.size(), accuracy) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
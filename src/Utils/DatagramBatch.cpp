@@ -0,0 +1,126 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : DatagramBatch.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Coalesces frames into datagrams up to the MTU with a flush deadline
+ *            Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "DatagramBatch.h"
+#include <string.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor
+  * @param      deadlineUs Longest time a frame waits for others, 0 to send every frame alone
+  * @return     Nothing
+  ********************************************************************************************** */
+DatagramBatch::DatagramBatch(uint32_t deadlineUs) {
+  this->fill = 0;
+  this->frames = 0;
+  this->firstFrameUs = 0;
+  this->deadlineUs = deadlineUs;
+  this->stats.framesSent = 0;
+  this->stats.datagramsSent = 0;
+  this->stats.framesDropped = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Change the flush deadline, applies to the current datagram too
+  * @param      deadlineUs Longest time a frame waits for others, 0 to send every frame alone
+  * @return     Nothing
+  ********************************************************************************************** */
+void DatagramBatch::setDeadline(uint32_t deadlineUs) {
+  this->deadlineUs = deadlineUs;
+}
+
+/**************************************************************************************************
+  * @brief      Add a whole frame to the current datagram
+  * @param      spans Parts of the frame, gathered straight into the datagram
+  * @param      count Number of spans
+  * @param      nowUs Current time, starts the deadline of an empty datagram
+  * @return     false if the frame does not fit, the datagram is left unchanged
+  ********************************************************************************************** */
+bool DatagramBatch::append(const TransportSpan* spans, size_t count, uint32_t nowUs) {
+  size_t length = ITransport::totalLength(spans, count);
+  if (length == 0 || length > DATAGRAM_BATCH_BYTES - this->fill) {
+    return false;
+  }
+  if (this->fill == 0) {
+    this->firstFrameUs = nowUs;
+  }
+  for (size_t i = 0; i < count; i++) {
+    memcpy(&this->buffer[this->fill], spans[i].data, spans[i].length);
+    this->fill += spans[i].length;
+  }
+  this->frames++;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Whether the current datagram must leave now
+  * @param      nowUs Current time
+  * @return     true if it holds frames and is full or its first frame reached the deadline
+  ********************************************************************************************** */
+bool DatagramBatch::due(uint32_t nowUs) const {
+  return this->fill > 0 && (this->fill == DATAGRAM_BATCH_BYTES ||
+                            nowUs - this->firstFrameUs >= this->deadlineUs);
+}
+
+/**************************************************************************************************
+  * @brief      Bytes of the current datagram
+  * @return     Pointer to the datagram
+  ********************************************************************************************** */
+const uint8_t* DatagramBatch::data() const {
+  return this->buffer;
+}
+
+/**************************************************************************************************
+  * @brief      Length of the current datagram
+  * @return     Length in bytes, 0 if no frame is pending
+  ********************************************************************************************** */
+size_t DatagramBatch::length() const {
+  return this->fill;
+}
+
+/**************************************************************************************************
+  * @brief      Start a new datagram once the current one was handed to the network stack
+  * @param      success false if the stack refused it, its frames are counted as dropped
+  * @return     Nothing
+  ********************************************************************************************** */
+void DatagramBatch::sent(bool success) {
+  if (success) {
+    this->stats.framesSent += this->frames;
+    this->stats.datagramsSent++;
+  } else {
+    this->stats.framesDropped += this->frames;
+  }
+  this->fill = 0;
+  this->frames = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Counters since construction
+  * @param      stats Receives the counters
+  * @return     Nothing
+  ********************************************************************************************** */
+void DatagramBatch::getStats(DatagramStats& stats) const {
+  stats = this->stats;
+}
@@ -0,0 +1,224 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : LatencyTrace.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Per-stage latency histograms based on the CPU cycle counter Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "LatencyTrace.h"
+#include <stdio.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Constants                                                                                     */
+/*-----------------------------------------------------------------------------------------------*/
+#define LATENCY_TRACE_CALIBRATION_RUNS  64
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor, starts the cycle counter and measures the tracing overhead
+  * @param      stageNames Stage names, kept by reference
+  * @param      stageCount Number of stages, clamped to LATENCY_TRACE_MAX_STAGES
+  * @return     Nothing
+  ********************************************************************************************** */
+LatencyTrace::LatencyTrace(const char* const* stageNames, uint8_t stageCount) {
+#if defined(ARDUINO_ARCH_STM32)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+  this->stageCount = stageCount < LATENCY_TRACE_MAX_STAGES ? stageCount : LATENCY_TRACE_MAX_STAGES;
+  for (uint8_t s = 0; s < LATENCY_TRACE_MAX_STAGES; s++) {
+    this->stages[s].name = s < this->stageCount ? stageNames[s] : nullptr;
+    this->starts[s] = 0;
+  }
+  this->overheadTicks = 0;
+  uint32_t fastest = UINT32_MAX;
+  for (uint8_t i = 0; i < LATENCY_TRACE_CALIBRATION_RUNS; i++) {
+    uint32_t start = now();
+    uint32_t ticks = now() - start;
+    if (ticks < fastest) {
+      fastest = ticks;
+    }
+  }
+  this->overheadTicks = fastest;
+  reset();
+}
+
+/**************************************************************************************************
+  * @brief      Clear every histogram
+  * @return     Nothing
+  ********************************************************************************************** */
+void LatencyTrace::reset() {
+  for (uint8_t s = 0; s < LATENCY_TRACE_MAX_STAGES; s++) {
+    this->stages[s].count = 0;
+    this->stages[s].maxTicks = 0;
+    for (uint16_t b = 0; b < LATENCY_TRACE_BUCKETS; b++) {
+      this->stages[s].buckets[b] = 0;
+    }
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Number of traced stages
+  * @return     Stage count
+  ********************************************************************************************** */
+uint8_t LatencyTrace::getStageCount() const {
+  return this->stageCount;
+}
+
+/**************************************************************************************************
+  * @brief      Cost of reading the tick counter twice, subtracted from every sample
+  * @return     Overhead in ns
+  ********************************************************************************************** */
+uint32_t LatencyTrace::getOverheadNs() const {
+  return ticksToNs(this->overheadTicks);
+}
+
+/**************************************************************************************************
+  * @brief      Summarise one stage
+  * @param      stage Stage index
+  * @param[out] report Sample count, median, 99th percentile and maximum
+  * @return     true if the stage exists
+  ********************************************************************************************** */
+bool LatencyTrace::getReport(uint8_t stage, LatencyReport& report) const {
+  if (stage >= this->stageCount) {
+    return false;
+  }
+  const Stage& traced = this->stages[stage];
+  report.name = traced.name;
+  report.count = traced.count;
+  report.p50Ns = ticksToNs(percentile(traced, 500));
+  report.p99Ns = ticksToNs(percentile(traced, 990));
+  report.maxNs = ticksToNs(traced.maxTicks);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Format one stage as a text line "<name> n=<count> p50=<ns> p99=<ns> max=<ns>\n"
+  * @param      stage Stage index
+  * @param[out] buffer Output buffer
+  * @param      size Buffer size
+  * @return     Line length, 0 if the stage does not exist or the buffer is too small
+  ********************************************************************************************** */
+size_t LatencyTrace::formatReport(uint8_t stage, char* buffer, size_t size) const {
+  LatencyReport report;
+  if (!getReport(stage, report)) {
+    return 0;
+  }
+  int length = snprintf(buffer, size, "%s n=%lu p50=%lu p99=%lu max=%lu\n", report.name,
+                        (unsigned long)report.count, (unsigned long)report.p50Ns,
+                        (unsigned long)report.p99Ns, (unsigned long)report.maxNs);
+  if (length < 0 || (size_t)length >= size) {
+    return 0;
+  }
+  return (size_t)length;
+}
+
+/**************************************************************************************************
+  * @brief      Convert counter ticks to nanoseconds
+  * @param      ticks Counter ticks
+  * @return     Nanoseconds, saturated
+  ********************************************************************************************** */
+uint32_t LatencyTrace::ticksToNs(uint32_t ticks) {
+#if defined(ARDUINO_ARCH_ESP32)
+  uint64_t ns = (uint64_t)ticks * 1000 / getCpuFrequencyMhz();
+#elif defined(ARDUINO_ARCH_STM32)
+  uint64_t ns = (uint64_t)ticks * 1000000000ULL / SystemCoreClock;
+#else
+  uint64_t ns = ticks;
+#endif
+  return ns > UINT32_MAX ? UINT32_MAX : (uint32_t)ns;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Add one sample to a stage histogram
+  * @param      stage Stage index
+  * @param      ticks Measured duration, tracing overhead included
+  * @return     Nothing
+  ********************************************************************************************** */
+void LatencyTrace::record(uint8_t stage, uint32_t ticks) {
+  Stage& traced = this->stages[stage];
+  ticks = ticks > this->overheadTicks ? ticks - this->overheadTicks : 0;
+  traced.buckets[bucketOf(ticks)]++;
+  traced.count++;
+  if (ticks > traced.maxTicks) {
+    traced.maxTicks = ticks;
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Walk a histogram up to a percentile
+  * @param      stage Stage to read
+  * @param      perMille Percentile, 500 for the median
+  * @return     Upper bound of the bucket holding the percentile in ticks, never above the maximum
+  ********************************************************************************************** */
+uint32_t LatencyTrace::percentile(const Stage& stage, uint32_t perMille) const {
+  if (stage.count == 0) {
+    return 0;
+  }
+  uint64_t rank = ((uint64_t)stage.count * perMille + 999) / 1000;
+  uint64_t seen = 0;
+  for (uint16_t b = 0; b < LATENCY_TRACE_BUCKETS; b++) {
+    seen += stage.buckets[b];
+    if (seen >= rank) {
+      uint32_t bound = bucketUpperBound((uint8_t)b);
+      return bound < stage.maxTicks ? bound : stage.maxTicks;
+    }
+  }
+  return stage.maxTicks;
+}
+
+/**************************************************************************************************
+  * @brief      Histogram bucket of a duration
+  * @param      ticks Duration
+  * @return     Bucket index: values below 4 are exact, then 4 buckets per power of two
+  ********************************************************************************************** */
+uint8_t LatencyTrace::bucketOf(uint32_t ticks) {
+  const uint32_t subBuckets = 1u << LATENCY_TRACE_SUB_BITS;
+  if (ticks < subBuckets) {
+    return (uint8_t)ticks;
+  }
+  uint8_t msb = (uint8_t)(31 - __builtin_clz(ticks));
+  uint32_t sub = (ticks >> (msb - LATENCY_TRACE_SUB_BITS)) & (subBuckets - 1);
+  uint32_t bucket = ((uint32_t)(msb - LATENCY_TRACE_SUB_BITS + 1) << LATENCY_TRACE_SUB_BITS) + sub;
+  return bucket < LATENCY_TRACE_BUCKETS ? (uint8_t)bucket : (uint8_t)(LATENCY_TRACE_BUCKETS - 1);
+}
+
+/**************************************************************************************************
+  * @brief      Largest duration falling in a bucket
+  * @param      bucket Bucket index
+  * @return     Upper bound in ticks, UINT32_MAX for the overflow bucket
+  ********************************************************************************************** */
+uint32_t LatencyTrace::bucketUpperBound(uint8_t bucket) {
+  const uint32_t subBuckets = 1u << LATENCY_TRACE_SUB_BITS;
+  if (bucket < subBuckets) {
+    return bucket;
+  }
+  if (bucket == LATENCY_TRACE_BUCKETS - 1) {
+    return UINT32_MAX;
+  }
+  uint8_t msb = (uint8_t)((bucket >> LATENCY_TRACE_SUB_BITS) - 1 + LATENCY_TRACE_SUB_BITS);
+  uint32_t sub = bucket & (subBuckets - 1);
+  uint32_t width = 1u << (msb - LATENCY_TRACE_SUB_BITS);
+  return (1u << msb) + sub * width + width - 1;
+}
@@ -0,0 +1,96 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : StaticArena.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Fixed-size arena the factories and modules construct their objects in
+ *            Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "StaticArena.h"
+#include <stdio.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+alignas(STATIC_ARENA_MAX_ALIGN) uint8_t StaticArena::storage[STATIC_ARENA_BYTES];
+size_t StaticArena::used = 0;
+uint32_t StaticArena::failures = 0;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Reserve memory for one object
+  * @param      size Object size in bytes
+  * @param      alignment Object alignment, a power of two up to STATIC_ARENA_MAX_ALIGN
+  * @return     Memory aligned on alignment and at least on STATIC_ARENA_ALIGN, nullptr if the
+  *             arena is full or the alignment is not supported
+  * @details    Padding skipped to reach a larger alignment stays unused, like freed memory.
+  ********************************************************************************************** */
+void* StaticArena::allocate(size_t size, size_t alignment) {
+  if (alignment > STATIC_ARENA_MAX_ALIGN || (alignment & (alignment - 1)) != 0) {
+    failures++;
+    return nullptr;
+  }
+  alignment = alignment > STATIC_ARENA_ALIGN ? alignment : STATIC_ARENA_ALIGN;
+  size_t start = (used + alignment - 1) & ~(alignment - 1);
+  size_t rounded = roundUp(size == 0 ? 1 : size);
+  if (start > STATIC_ARENA_BYTES || rounded > STATIC_ARENA_BYTES - start) {
+    failures++;
+    return nullptr;
+  }
+  used = start + rounded;
+  return &storage[start];
+}
+
+/**************************************************************************************************
+  * @brief      Bytes reserved since boot, memory is never released
+  * @return     High-water mark in bytes
+  ********************************************************************************************** */
+size_t StaticArena::getHighWaterMark() {
+  return used;
+}
+
+/**************************************************************************************************
+  * @brief      Arena size
+  * @return     STATIC_ARENA_BYTES
+  ********************************************************************************************** */
+size_t StaticArena::getCapacity() {
+  return STATIC_ARENA_BYTES;
+}
+
+/**************************************************************************************************
+  * @brief      Requests refused because the arena was full
+  * @return     Failure count
+  ********************************************************************************************** */
+uint32_t StaticArena::getFailures() {
+  return failures;
+}
+
+/**************************************************************************************************
+  * @brief      Format the usage as one text line
+  * @param      buffer Destination
+  * @param      size Size of the destination
+  * @return     Line length, 0 if it does not fit
+  ********************************************************************************************** */
+size_t StaticArena::formatReport(char* buffer, size_t size) {
+  int length = snprintf(buffer, size, "arena used=%lu capacity=%lu failures=%lu\n",
+                        (unsigned long)used, (unsigned long)STATIC_ARENA_BYTES,
+                        (unsigned long)failures);
+  return (length > 0 && (size_t)length < size) ? (size_t)length : 0;
+}
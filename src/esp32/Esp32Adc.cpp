@@ -21,6 +21,7 @@
 /* Includes                                                                                      */
 /*-----------------------------------------------------------------------------------------------*/
 #include "esp32/Esp32Adc.h"
+#include <driver/adc.h>
 
 /*-----------------------------------------------------------------------------------------------*/
 /* Public methods                                                                                */
@@ -31,6 +32,10 @@
   ********************************************************************************************** */
 Esp32Adc::Esp32Adc(uint8_t pin) {
   this->pin = pin;
+  this->continuous = false;
+  this->decimation = 1;
+  this->decimationCount = 0;
+  this->decimationSum = 0;
 }
 
 /**************************************************************************************************
@@ -51,9 +56,115 @@ bool Esp32Adc::setup() {
   * @return     ADC reading
   ********************************************************************************************** */
 bool Esp32Adc::read(uint16_t& value) {
-  if (this->pin >= 0) {
+  if (this->pin >= 0 && !this->continuous) {
     value = analogRead(this->pin);
     return true;
   }
   return false;
-} 
\ No newline at end of file
+} 
+
+/**************************************************************************************************
+  * @brief      Start DMA driven continuous sampling
+  * @param      sampleRateHz Sampling frequency
+  * @return     true if continuous mode started
+  * @details    The DMA controller cannot run slower than ESP32_ADC_DMA_MIN_RATE_HZ, so lower
+  *             rates are obtained by oversampling and averaging groups of conversions, which
+  *             also lowers the ADC noise floor. Only ADC1 pins support DMA.
+  ********************************************************************************************** */
+bool Esp32Adc::startContinuous(uint32_t sampleRateHz) {
+  int8_t channel = digitalPinToAnalogChannel(this->pin);
+  if (this->continuous || sampleRateHz == 0 || channel < 0 || channel > 7) {
+    return false;
+  }
+
+  this->decimation = (ESP32_ADC_DMA_MIN_RATE_HZ + sampleRateHz - 1) / sampleRateHz;
+  if (this->decimation == 0) {
+    this->decimation = 1;
+  }
+  this->decimationCount = 0;
+  this->decimationSum = 0;
+
+  adc_digi_init_config_t initConfig = {};
+  initConfig.max_store_buf_size = ESP32_ADC_DMA_BUFFER_BYTES;
+  initConfig.conv_num_each_intr = ESP32_ADC_DMA_FRAME_BYTES;
+  initConfig.adc1_chan_mask = BIT(channel);
+  initConfig.adc2_chan_mask = 0;
+  if (adc_digi_initialize(&initConfig) != ESP_OK) {
+    return false;
+  }
+
+  adc_digi_pattern_config_t pattern = {};
+  pattern.atten = ADC_ATTEN_DB_11;
+  pattern.channel = channel;
+  pattern.unit = 0;  // ADC1
+  pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+
+  adc_digi_configuration_t config = {};
+  config.conv_limit_en = true;
+  config.conv_limit_num = 250;
+  config.pattern_num = 1;
+  config.adc_pattern = &pattern;
+  config.sample_freq_hz = sampleRateHz * this->decimation;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+  if (adc_digi_controller_configure(&config) != ESP_OK || adc_digi_start() != ESP_OK) {
+    adc_digi_deinitialize();
+    return false;
+  }
+
+  this->continuous = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Stop continuous sampling and release the DMA driver
+  * @return     true if continuous mode was running
+  ********************************************************************************************** */
+bool Esp32Adc::stopContinuous() {
+  if (!this->continuous) {
+    return false;
+  }
+  adc_digi_stop();
+  adc_digi_deinitialize();
+  this->continuous = false;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Read the samples converted so far
+  * @param      dst Destination buffer
+  * @param      n Capacity of dst in samples
+  * @param      samplesRead Number of samples stored in dst
+  * @return     true if at least one sample was read
+  * @details    Never waits: only the conversions already moved to the driver buffer by DMA
+  *             are consumed, at most the amount needed to produce n decimated samples.
+  ********************************************************************************************** */
+bool Esp32Adc::readBlock(uint16_t* dst, size_t n, size_t& samplesRead) {
+  samplesRead = 0;
+  if (!this->continuous || dst == nullptr || n == 0) {
+    return false;
+  }
+
+  uint8_t raw[ESP32_ADC_DMA_FRAME_BYTES];
+  while (samplesRead < n) {
+    size_t pending = (n - samplesRead) * this->decimation - this->decimationCount;
+    uint32_t maxBytes = pending * SOC_ADC_DIGI_RESULT_BYTES;
+    if (maxBytes > sizeof(raw)) {
+      maxBytes = sizeof(raw);
+    }
+    uint32_t length = 0;
+    if (adc_digi_read_bytes(raw, maxBytes, &length, 0) != ESP_OK || length == 0) {
+      break;
+    }
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+      const adc_digi_output_data_t* result = (const adc_digi_output_data_t*)&raw[i];
+      this->decimationSum += result->type1.data;
+      if (++this->decimationCount == this->decimation) {
+        dst[samplesRead++] = this->decimationSum / this->decimation;
+        this->decimationCount = 0;
+        this->decimationSum = 0;
+      }
+    }
+  }
+  return samplesRead > 0;
+}
@@ -0,0 +1,222 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32AdcScan.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 multi-channel ADC scan Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "esp32/Esp32AdcScan.h"
+#include <driver/adc.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor
+  * @param      pins ADC1 pins in scan order
+  * @param      count Number of pins, at most ADC_SCAN_MAX_CHANNELS
+  * @return     Nothing
+  ********************************************************************************************** */
+Esp32AdcScan::Esp32AdcScan(const uint8_t* pins, uint8_t count) {
+  this->count = count < ADC_SCAN_MAX_CHANNELS ? count : ADC_SCAN_MAX_CHANNELS;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+  }
+  for (uint8_t i = 0; i < ADC_SCAN_MAX_CHANNELS; i++) {
+    this->slotOfChannel[i] = -1;
+    this->decimationCount[i] = 0;
+    this->decimationSum[i] = 0;
+    this->pending[i] = 0;
+  }
+  this->scanning = false;
+  this->scanRateHz = 0;
+  this->startUs = 0;
+  this->scanIndex = 0;
+  this->decimation = 1;
+  this->completed = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Map the pins to ADC1 channels
+  * @return     true if every pin is a distinct ADC1 input
+  ********************************************************************************************** */
+bool Esp32AdcScan::setup() {
+  for (uint8_t i = 0; i < ADC_SCAN_MAX_CHANNELS; i++) {
+    this->slotOfChannel[i] = -1;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    int8_t channel = digitalPinToAnalogChannel(this->pins[i]);
+    if (channel < 0 || channel >= ADC_SCAN_MAX_CHANNELS || this->slotOfChannel[channel] >= 0) {
+      return false;
+    }
+    this->slotOfChannel[channel] = (int8_t)i;
+    pinMode(this->pins[i], INPUT);
+  }
+  return this->count > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Number of scanned pins
+  * @return     Channel count
+  ********************************************************************************************** */
+uint8_t Esp32AdcScan::channelCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Start DMA driven scanning with one pattern table entry per pin
+  * @param      scanRateHz Scans per second
+  * @return     true if scanning started
+  * @details    The controller converts at least ESP32_ADC_DMA_MIN_RATE_HZ conversions per
+  *             second over all pins. Slower scan rates are obtained by averaging consecutive
+  *             hardware scans, like Esp32Adc does for a single pin.
+  ********************************************************************************************** */
+bool Esp32AdcScan::startScan(uint32_t scanRateHz) {
+  if (this->scanning || scanRateHz == 0 || this->count == 0) {
+    return false;
+  }
+  uint32_t conversionRate = scanRateHz * this->count;
+  this->decimation = (ESP32_ADC_DMA_MIN_RATE_HZ + conversionRate - 1) / conversionRate;
+  if (this->decimation == 0) {
+    this->decimation = 1;
+  }
+
+  adc_digi_init_config_t initConfig = {};
+  initConfig.max_store_buf_size = ESP32_ADC_DMA_BUFFER_BYTES;
+  initConfig.conv_num_each_intr = ESP32_ADC_DMA_FRAME_BYTES;
+  initConfig.adc2_chan_mask = 0;
+  adc_digi_pattern_config_t patterns[ADC_SCAN_MAX_CHANNELS] = {};
+  for (uint8_t i = 0; i < this->count; i++) {
+    int8_t channel = digitalPinToAnalogChannel(this->pins[i]);
+    initConfig.adc1_chan_mask |= BIT(channel);
+    patterns[i].atten = ADC_ATTEN_DB_11;
+    patterns[i].channel = channel;
+    patterns[i].unit = 0;  // ADC1
+    patterns[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+  }
+  if (adc_digi_initialize(&initConfig) != ESP_OK) {
+    return false;
+  }
+
+  adc_digi_configuration_t config = {};
+  config.conv_limit_en = true;
+  config.conv_limit_num = 250;
+  config.pattern_num = this->count;
+  config.adc_pattern = patterns;
+  config.sample_freq_hz = conversionRate * this->decimation;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+  if (adc_digi_controller_configure(&config) != ESP_OK || adc_digi_start() != ESP_OK) {
+    adc_digi_deinitialize();
+    return false;
+  }
+
+  for (uint8_t i = 0; i < ADC_SCAN_MAX_CHANNELS; i++) {
+    this->decimationCount[i] = 0;
+    this->decimationSum[i] = 0;
+  }
+  this->completed = 0;
+  this->scanRateHz = scanRateHz;
+  this->startUs = micros();
+  this->scanIndex = 0;
+  this->scanning = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Stop scanning and release the DMA driver
+  * @return     true if scanning was running
+  ********************************************************************************************** */
+bool Esp32AdcScan::stopScan() {
+  if (!this->scanning) {
+    return false;
+  }
+  adc_digi_stop();
+  adc_digi_deinitialize();
+  this->scanning = false;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      De-interleave the scans moved to the driver buffer so far
+  * @param      channels One destination array per channel
+  * @param      timestampsUs Scan times, may be nullptr
+  * @param      maxScans Capacity of every destination array
+  * @param      scansRead Number of scans stored
+  * @return     true if at least one scan was read
+  * @details    Conversions are routed by the channel number the DMA writes with each result,
+  *             so a lost conversion cannot shift samples into the wrong channel. Scan times
+  *             come from the scan counter, the hardware paces the scans exactly.
+  ********************************************************************************************** */
+bool Esp32AdcScan::readScans(uint16_t* const* channels, uint32_t* timestampsUs, size_t maxScans,
+                             size_t& scansRead) {
+  scansRead = 0;
+  if (!this->scanning || channels == nullptr || maxScans == 0) {
+    return false;
+  }
+
+  const uint8_t allChannels = (uint8_t)((1u << this->count) - 1);
+  uint8_t raw[ESP32_ADC_DMA_FRAME_BYTES];
+  while (scansRead < maxScans) {
+    // Conversions still needed to complete maxScans, so nothing is left unread in raw
+    size_t progress = 0;
+    for (uint8_t c = 0; c < this->count; c++) {
+      progress += (this->completed & (1u << c)) ? this->decimation : this->decimationCount[c];
+    }
+    size_t needed = (maxScans - scansRead) * this->decimation * this->count - progress;
+    uint32_t maxBytes = needed * SOC_ADC_DIGI_RESULT_BYTES;
+    if (maxBytes > sizeof(raw)) {
+      maxBytes = sizeof(raw);
+    }
+    uint32_t length = 0;
+    if (adc_digi_read_bytes(raw, maxBytes, &length, 0) != ESP_OK || length == 0) {
+      break;
+    }
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length && scansRead < maxScans;
+         i += SOC_ADC_DIGI_RESULT_BYTES) {
+      const adc_digi_output_data_t* result = (const adc_digi_output_data_t*)&raw[i];
+      uint8_t channel = result->type1.channel;
+      int8_t slot = channel < ADC_SCAN_MAX_CHANNELS ? this->slotOfChannel[channel] : -1;
+      if (slot < 0) {
+        continue;
+      }
+      this->decimationSum[slot] += result->type1.data;
+      if (++this->decimationCount[slot] < this->decimation) {
+        continue;
+      }
+      this->pending[slot] = this->decimationSum[slot] / this->decimation;
+      this->decimationCount[slot] = 0;
+      this->decimationSum[slot] = 0;
+      this->completed |= (uint8_t)(1u << slot);
+      if (this->completed != allChannels) {
+        continue;
+      }
+      for (uint8_t c = 0; c < this->count; c++) {
+        channels[c][scansRead] = this->pending[c];
+      }
+      if (timestampsUs != nullptr) {
+        timestampsUs[scansRead] =
+          this->startUs + (uint32_t)((uint64_t)this->scanIndex * 1000000 / this->scanRateHz);
+      }
+      this->scanIndex++;
+      this->completed = 0;
+      scansRead++;
+    }
+  }
+  return scansRead > 0;
+}
@@ -0,0 +1,137 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32CoreTask.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 pinned FreeRTOS task Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "esp32/Esp32CoreTask.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for ESP32 core task
+  * @param      name Task name
+  * @param      core Core the task is pinned to, 0 or 1
+  * @param      priority FreeRTOS priority, the Arduino loop task has 1
+  * @return     Nothing
+  ********************************************************************************************** */
+Esp32CoreTask::Esp32CoreTask(const char* name, uint8_t core, uint8_t priority)
+  : running(false), steps(0), overruns(0) {
+  this->name = name;
+  this->core = core;
+  this->priority = priority;
+  this->step = nullptr;
+  this->context = nullptr;
+  this->periodUs = 0;
+  this->finished = nullptr;
+}
+
+/**************************************************************************************************
+  * @brief      Destructor, stops the task
+  * @return     Nothing
+  ********************************************************************************************** */
+Esp32CoreTask::~Esp32CoreTask() {
+  stop();
+  if (this->finished != nullptr) {
+    vSemaphoreDelete((SemaphoreHandle_t)this->finished);
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Create the task on its core
+  * @param      step Function called every period
+  * @param      context Argument of step
+  * @param      periodUs Period in microseconds, rounded up to RTOS ticks
+  * @return     true if the task was created
+  ********************************************************************************************** */
+bool Esp32CoreTask::start(CoreTaskStep step, void* context, uint32_t periodUs) {
+  if (step == nullptr || this->running.load() || this->core >= portNUM_PROCESSORS) {
+    return false;
+  }
+  if (this->finished == nullptr) {
+    this->finished = xSemaphoreCreateBinary();
+    if (this->finished == nullptr) {
+      return false;
+    }
+  }
+  this->step = step;
+  this->context = context;
+  this->periodUs = periodUs;
+  this->running.store(true);
+  if (xTaskCreatePinnedToCore(entry, this->name, ESP32_CORE_TASK_STACK_BYTES, this,
+                              this->priority, nullptr, this->core) != pdPASS) {
+    this->running.store(false);
+    return false;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Ask the task to leave its loop and wait until it has
+  * @return     true if the task was running
+  ********************************************************************************************** */
+bool Esp32CoreTask::stop() {
+  if (!this->running.exchange(false)) {
+    return false;
+  }
+  xSemaphoreTake((SemaphoreHandle_t)this->finished, portMAX_DELAY);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Get the step and overrun counters
+  * @param[out] stats Counters since construction
+  * @return     true
+  ********************************************************************************************** */
+bool Esp32CoreTask::getStats(CoreTaskStats& stats) const {
+  stats.steps = this->steps.load(std::memory_order_relaxed);
+  stats.overruns = this->overruns.load(std::memory_order_relaxed);
+  return true;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Task body: step, then sleep until the next period
+  * @param      argument The Esp32CoreTask
+  * @return     Nothing, the task deletes itself once stopped
+  * @details    xTaskDelayUntil() returns pdFALSE when the wake time has already passed, which
+  *             is counted as an overrun.
+  ********************************************************************************************** */
+void Esp32CoreTask::entry(void* argument) {
+  Esp32CoreTask* task = (Esp32CoreTask*)argument;
+  TickType_t period = pdMS_TO_TICKS((task->periodUs + 999) / 1000);
+  period = period > 0 ? period : 1;
+  TickType_t lastWake = xTaskGetTickCount();
+  while (task->running.load(std::memory_order_acquire)) {
+    task->step(task->context);
+    task->steps.fetch_add(1, std::memory_order_relaxed);
+    if (xTaskDelayUntil(&lastWake, period) == pdFALSE) {
+      task->overruns.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  xSemaphoreGive((SemaphoreHandle_t)task->finished);
+  vTaskDelete(nullptr);
+}
@@ -0,0 +1,159 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32GpioPort.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 GPIO Port Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "esp32/Esp32GpioPort.h"
+#include <soc/gpio_struct.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for ESP32 GPIO port
+  * @param      pins Pins of the port, bit i of the masks is pins[i]
+  * @param      count Number of pins, at most GPIO_PORT_MAX_PINS
+  * @param      mode Mode of every pin
+  * @return     Nothing
+  ********************************************************************************************** */
+Esp32GpioPort::Esp32GpioPort(const uint8_t* pins, uint8_t count, uint8_t mode) {
+  this->count = count < GPIO_PORT_MAX_PINS ? count : GPIO_PORT_MAX_PINS;
+  this->mode = mode;
+  this->usesHighBank = false;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+    this->usesHighBank |= pins[i] >= 32;
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Setup every pin of the port
+  * @return     true if every pin is a GPIO
+  ********************************************************************************************** */
+bool Esp32GpioPort::setup() {
+  for (uint8_t i = 0; i < this->count; i++) {
+    if (this->pins[i] >= 40) {
+      return false;
+    }
+    pinMode(this->pins[i], this->mode);
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Number of pins in the port
+  * @return     Pin count
+  ********************************************************************************************** */
+uint8_t Esp32GpioPort::pinCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Drive several output pins at once
+  * @param      mask Pins to drive
+  * @param      levels New level of each pin in mask
+  * @return     true if the port is an output
+  ********************************************************************************************** */
+bool Esp32GpioPort::write(uint32_t mask, uint32_t levels) {
+  if (this->mode != OUTPUT) {
+    return false;
+  }
+  uint32_t set[2] = {0, 0};
+  uint32_t clear[2] = {0, 0};
+  for (uint8_t i = 0; i < this->count; i++) {
+    if ((mask & (1u << i)) == 0) {
+      continue;
+    }
+    uint8_t bank = this->pins[i] >> 5;
+    uint32_t bit = 1u << (this->pins[i] & 31);
+    if ((levels & (1u << i)) != 0) {
+      set[bank] |= bit;
+    } else {
+      clear[bank] |= bit;
+    }
+  }
+  GPIO.out_w1ts = set[0];
+  GPIO.out_w1tc = clear[0];
+  if (this->usesHighBank) {
+    GPIO.out1_w1ts.val = set[1];
+    GPIO.out1_w1tc.val = clear[1];
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Sample every pin of the port
+  * @param[out] levels Bit i is the level of pins[i]
+  * @return     true if the port is an input
+  ********************************************************************************************** */
+bool Esp32GpioPort::read(uint32_t& levels) {
+  if (!this->isInput()) {
+    return false;
+  }
+  uint32_t in[2];
+  in[0] = GPIO.in;
+  in[1] = this->usesHighBank ? GPIO.in1.val : 0;
+  levels = 0;
+  for (uint8_t i = 0; i < this->count; i++) {
+    levels |= ((in[this->pins[i] >> 5] >> (this->pins[i] & 31)) & 1u) << i;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Call a function when any pin of an input port changes level
+  * @param      callback Interrupt handler, must be in IRAM
+  * @param      context Passed to the handler
+  * @return     true if the interrupts were attached
+  ********************************************************************************************** */
+bool Esp32GpioPort::attachChangeInterrupt(GpioCallback callback, void* context) {
+  if (!this->isInput() || callback == nullptr) {
+    return false;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    attachInterruptArg(digitalPinToInterrupt(this->pins[i]), callback, context, CHANGE);
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Remove the level change interrupts
+  * @return     true if the port is an input
+  ********************************************************************************************** */
+bool Esp32GpioPort::detachChangeInterrupt() {
+  if (!this->isInput()) {
+    return false;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    detachInterrupt(digitalPinToInterrupt(this->pins[i]));
+  }
+  return true;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Check whether the port was configured as an input, with or without pull resistor
+  * @return     true for INPUT, INPUT_PULLUP and INPUT_PULLDOWN
+  ********************************************************************************************** */
+bool Esp32GpioPort::isInput() const {
+  return this->mode == INPUT || this->mode == INPUT_PULLUP || this->mode == INPUT_PULLDOWN;
+}
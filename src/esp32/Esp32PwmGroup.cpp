@@ -0,0 +1,134 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32PwmGroup.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 LEDC PWM group Implementation
+ * 
+ **************************************************************************************************
+ * 
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ * 
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "esp32/Esp32PwmGroup.h"
+#include <driver/ledc.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Helpers                                                                                       */
+/*-----------------------------------------------------------------------------------------------*/
+static ledc_mode_t speedMode(uint8_t channel) {
+  return channel < LEDC_CHANNEL_MAX ? LEDC_HIGH_SPEED_MODE : LEDC_LOW_SPEED_MODE;
+}
+
+static ledc_channel_t ledcChannel(uint8_t channel) {
+  return (ledc_channel_t)(channel % LEDC_CHANNEL_MAX);
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for ESP32 PWM group
+  * @param      pins Output pins, channel i drives pins[i]
+  * @param      count Number of pins, at most ESP32_PWM_GROUP_MAX_CHANNELS
+  * @return     Nothing
+  ********************************************************************************************** */
+Esp32PwmGroup::Esp32PwmGroup(const uint8_t* pins, uint8_t count) {
+  this->count = count < ESP32_PWM_GROUP_MAX_CHANNELS ? count : ESP32_PWM_GROUP_MAX_CHANNELS;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+    this->staged[i] = 0;
+  }
+  this->dirty = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Configure the LEDC timers and bind every pin to its channel, outputs start low
+  * @return     true if setup successful
+  ********************************************************************************************** */
+bool Esp32PwmGroup::setup() {
+  const ledc_mode_t modes[2] = { LEDC_HIGH_SPEED_MODE, LEDC_LOW_SPEED_MODE };
+  for (uint8_t m = 0; m < 2; m++) {
+    ledc_timer_config_t timer = {};
+    timer.speed_mode = modes[m];
+    timer.duty_resolution = LEDC_TIMER_8_BIT;
+    timer.timer_num = LEDC_TIMER_0;
+    timer.freq_hz = ESP32_PWM_GROUP_FREQUENCY_HZ;
+    timer.clk_cfg = LEDC_AUTO_CLK;
+    if (ledc_timer_config(&timer) != ESP_OK) {
+      return false;
+    }
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    ledc_channel_config_t channel = {};
+    channel.gpio_num = this->pins[i];
+    channel.speed_mode = speedMode(i);
+    channel.channel = ledcChannel(i);
+    channel.intr_type = LEDC_INTR_DISABLE;
+    channel.timer_sel = LEDC_TIMER_0;
+    channel.duty = 0;
+    channel.hpoint = 0;
+    if (ledc_channel_config(&channel) != ESP_OK) {
+      return false;
+    }
+    this->staged[i] = 0;
+  }
+  this->dirty = 0;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Number of channels in the group
+  * @return     Channel count
+  ********************************************************************************************** */
+uint8_t Esp32PwmGroup::channelCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Stage a duty cycle, the output keeps its current duty until commit()
+  * @return     true if the channel exists
+  ********************************************************************************************** */
+bool Esp32PwmGroup::stage(uint8_t channel, uint8_t dutyCycle) {
+  if (channel >= this->count) {
+    return false;
+  }
+  if (this->staged[channel] != dutyCycle) {
+    this->staged[channel] = dutyCycle;
+    this->dirty |= (uint16_t)(1u << channel);
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Apply every staged duty cycle
+  * @return     true if all channels were updated
+  * @details    Duty registers are loaded first and the update strobes issued back to back
+  *             afterwards, so the new duties start on the same PWM period. Unchanged channels
+  *             are not touched.
+  ********************************************************************************************** */
+bool Esp32PwmGroup::commit() {
+  bool success = true;
+  for (uint8_t i = 0; i < this->count; i++) {
+    if (this->dirty & (1u << i)) {
+      success &= (ledc_set_duty(speedMode(i), ledcChannel(i), this->staged[i]) == ESP_OK);
+    }
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    if (this->dirty & (1u << i)) {
+      success &= (ledc_update_duty(speedMode(i), ledcChannel(i)) == ESP_OK);
+    }
+  }
+  this->dirty = 0;
+  return success;
+}
@@ -0,0 +1,177 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Esp32Wifi.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : ESP32 WiFi UDP Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "esp32/Esp32Wifi.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+static WiFiUDP udp;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for ESP32 WiFi
+  * @param      localPort UDP port to listen on
+  * @param      remotePort UDP port of the receiver
+  * @return     Nothing
+  ********************************************************************************************** */
+Esp32Wifi::Esp32Wifi(uint16_t localPort, uint16_t remotePort) : batch(WIFI_FLUSH_DEADLINE_US) {
+  this->localPort = localPort;
+  this->remotePort = remotePort;
+  this->remoteAddress = 0;
+  this->connected = false;
+}
+
+/**************************************************************************************************
+  * @brief      Join the access point and open the UDP socket
+  * @return     true if connected within WIFI_CONNECT_TIMEOUT_MS and the socket is open
+  * @details    Blocks during boot only.
+  ********************************************************************************************** */
+bool Esp32Wifi::setup() {
+  IPAddress remote;
+  if (!remote.fromString(WIFI_REMOTE_IP)) {
+    return false;
+  }
+  this->remoteAddress = (uint32_t)remote;
+  WiFi.mode(WIFI_STA);
+  WiFi.setSleep(false);
+  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+  uint32_t start = millis();
+  while (WiFi.status() != WL_CONNECTED) {
+    if (millis() - start > WIFI_CONNECT_TIMEOUT_MS) {
+      return false;
+    }
+    delay(10);
+  }
+  this->connected = udp.begin(this->localPort) == 1;
+  return this->connected;
+}
+
+/**************************************************************************************************
+  * @brief      Gather a frame into the current datagram
+  * @param      spans Parts of the frame, kept whole in one datagram
+  * @param      count Number of spans
+  * @param      bytesWritten Frame length if the frame was accepted
+  * @return     true if the frame was accepted
+  * @details    Sends the current datagram first when the frame does not fit, and right after
+  *             when the flush deadline is reached.
+  ********************************************************************************************** */
+bool Esp32Wifi::writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) {
+  bytesWritten = 0;
+  size_t length = ITransport::totalLength(spans, count);
+  if (!this->connected || spans == nullptr || length == 0 || length > DATAGRAM_BATCH_BYTES) {
+    return false;
+  }
+  uint32_t nowUs = micros();
+  if (!this->batch.append(spans, count, nowUs)) {
+    sendBatch();
+    this->batch.append(spans, count, nowUs);
+  }
+  if (this->batch.due(nowUs)) {
+    sendBatch();
+  }
+  bytesWritten = length;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Read received datagram bytes
+  * @param      buffer Destination
+  * @param      length Size of the destination
+  * @param      bytesRead Number of bytes read
+  * @return     true if at least one byte was read
+  * @details    A datagram larger than the buffer is returned over several calls. Its sender
+  *             becomes the destination of the next datagrams.
+  ********************************************************************************************** */
+bool Esp32Wifi::readData(uint8_t* buffer, size_t length, size_t& bytesRead) {
+  if (!this->connected || buffer == nullptr || length == 0) {
+    return false;
+  }
+  if (udp.available() <= 0) {
+    if (udp.parsePacket() <= 0) {
+      return false;
+    }
+    this->remoteAddress = (uint32_t)udp.remoteIP();
+    this->remotePort = udp.remotePort();
+  }
+  int received = udp.read(buffer, length);
+  bytesRead = received > 0 ? (size_t)received : 0;
+  return bytesRead > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Largest frame writeSpans() accepts without waiting
+  * @param      space DATAGRAM_BATCH_BYTES, a frame that does not fit sends the datagram first
+  * @return     true if the link is up
+  ********************************************************************************************** */
+bool Esp32Wifi::availableForWrite(size_t& space) {
+  space = DATAGRAM_BATCH_BYTES;
+  return this->connected;
+}
+
+/**************************************************************************************************
+  * @brief      Send the current datagram once its flush deadline is reached
+  * @return     false if the datagram was refused by the network stack
+  ********************************************************************************************** */
+bool Esp32Wifi::update() {
+  return !this->batch.due(micros()) || sendBatch();
+}
+
+/**************************************************************************************************
+  * @brief      Change the flush deadline set by WIFI_FLUSH_DEADLINE_US
+  * @param      deadlineUs Longest time a frame waits for others, 0 to send every frame alone
+  * @return     Nothing
+  ********************************************************************************************** */
+void Esp32Wifi::setFlushDeadline(uint32_t deadlineUs) {
+  this->batch.setDeadline(deadlineUs);
+}
+
+/**************************************************************************************************
+  * @brief      Datagram counters
+  * @param      stats Receives the counters
+  * @return     Nothing
+  ********************************************************************************************** */
+void Esp32Wifi::getStats(DatagramStats& stats) const {
+  this->batch.getStats(stats);
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Hand the current datagram to lwIP and start a new one
+  * @return     true if lwIP accepted it
+  ********************************************************************************************** */
+bool Esp32Wifi::sendBatch() {
+  if (this->batch.length() == 0) {
+    return true;
+  }
+  bool success = udp.beginPacket(IPAddress(this->remoteAddress), this->remotePort) == 1 &&
+                 udp.write(this->batch.data(), this->batch.length()) == this->batch.length() &&
+                 udp.endPacket() == 1;
+  this->batch.sent(success);
+  return success;
+}
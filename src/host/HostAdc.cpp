@@ -0,0 +1,177 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostAdc.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host ADC Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostAdc.h"
+#include "host/HostClock.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+HostAdcSource HostAdc::source = HostAdc::syntheticEmg;
+void* HostAdc::sourceContext = nullptr;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Host ADC
+  * @return     Nothing
+  ********************************************************************************************** */
+HostAdc::HostAdc(uint8_t pin) {
+  this->pin = pin;
+  this->continuous = false;
+  this->sampleRateHz = 0;
+  this->startUs = 0;
+  this->sampleIndex = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Setup ADC pin
+  * @return     true if setup successful
+  ********************************************************************************************** */
+bool HostAdc::setup() {
+  return source != nullptr;
+}
+
+/**************************************************************************************************
+  * @brief      Read ADC value
+  * @return     true if read successful
+  * @details    Samples the signal source at the current simulated time, then consumes the
+  *             conversion time like a blocking analogRead() would.
+  ********************************************************************************************** */
+bool HostAdc::read(uint16_t& value) {
+  if (source == nullptr || this->continuous) {
+    return false;
+  }
+  value = source(this->pin, HostClock::nowUs(), sourceContext) & 0x0FFF;
+  HostClock::advance(HOST_ADC_CONVERSION_US);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Start timer-paced sampling
+  * @param      sampleRateHz Sampling frequency
+  * @return     true if continuous mode started
+  ********************************************************************************************** */
+bool HostAdc::startContinuous(uint32_t sampleRateHz) {
+  if (source == nullptr || sampleRateHz == 0 || this->continuous) {
+    return false;
+  }
+  this->sampleRateHz = sampleRateHz;
+  this->startUs = HostClock::nowUs();
+  this->sampleIndex = 0;
+  this->continuous = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Stop timer-paced sampling
+  * @return     true if continuous mode was running
+  ********************************************************************************************** */
+bool HostAdc::stopContinuous() {
+  if (!this->continuous) {
+    return false;
+  }
+  this->continuous = false;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Read the samples converted so far
+  * @param      dst Destination buffer
+  * @param      n Capacity of dst in samples
+  * @param      samplesRead Number of samples stored in dst
+  * @return     true if at least one sample was read
+  * @details    The simulated timer fires at startUs + k / sampleRateHz. When no sample is due
+  *             yet, the clock is advanced to the next tick, which is what a loop polling the
+  *             real driver would end up doing. Samples older than the simulated buffer are
+  *             dropped like a DMA overrun would.
+  ********************************************************************************************** */
+bool HostAdc::readBlock(uint16_t* dst, size_t n, size_t& samplesRead) {
+  samplesRead = 0;
+  if (!this->continuous || dst == nullptr || n == 0) {
+    return false;
+  }
+  uint64_t now = HostClock::nowUs();
+  if (sampleTimeUs(this->sampleIndex) > now) {
+    now = sampleTimeUs(this->sampleIndex);
+    HostClock::advanceTo(now);
+  }
+  uint64_t due = (now - this->startUs) * this->sampleRateHz / 1000000 + 1;
+  if (due - this->sampleIndex > HOST_ADC_BUFFER_SAMPLES) {
+    this->sampleIndex = due - HOST_ADC_BUFFER_SAMPLES;
+  }
+  while (this->sampleIndex < due && samplesRead < n) {
+    dst[samplesRead++] = source(this->pin, sampleTimeUs(this->sampleIndex), sourceContext) & 0x0FFF;
+    this->sampleIndex++;
+  }
+  return samplesRead > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Select the signal fed to every host ADC
+  * @param      source Callback returning a 12-bit sample for a pin at a given time
+  * @param      context Opaque pointer handed back to the callback
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostAdc::setSource(HostAdcSource source, void* context) {
+  HostAdc::source = source;
+  HostAdc::sourceContext = context;
+}
+
+/**************************************************************************************************
+  * @brief      Default signal source: deterministic synthetic EMG
+  * @param      pin ADC pin, used to decorrelate channels
+  * @param      timeUs Sampling time in microseconds
+  * @param      context Unused
+  * @return     12-bit sample centred on mid-scale
+  * @details    Low amplitude noise with a one second muscle contraction every three seconds.
+  *             The noise is a hash of (pin, time) so the signal does not depend on call order.
+  ********************************************************************************************** */
+uint16_t HostAdc::syntheticEmg(uint8_t pin, uint64_t timeUs, void* context) {
+  (void)context;
+  uint32_t hash = (uint32_t)(timeUs / HOST_ADC_CONVERSION_US) * 2654435761u ^ (uint32_t)pin * 40503u;
+  hash ^= hash >> 15;
+  hash *= 2246822519u;
+  hash ^= hash >> 13;
+  int32_t noise = (int32_t)(hash & 0xFF) - 128;
+  bool contracted = (timeUs % 3000000) < 1000000;
+  int32_t value = 2048 + (contracted ? noise * 8 : noise / 2);
+  if (value < 0) {
+    value = 0;
+  } else if (value > 4095) {
+    value = 4095;
+  }
+  return (uint16_t)value;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Get the conversion time of a continuous mode sample
+  * @param      index Sample index since startContinuous()
+  * @return     Time in microseconds
+  ********************************************************************************************** */
+uint64_t HostAdc::sampleTimeUs(uint64_t index) const {
+  return this->startUs + (index * 1000000 + this->sampleRateHz - 1) / this->sampleRateHz;
+}
@@ -0,0 +1,142 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostAdcScan.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host multi-channel ADC scan Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostAdcScan.h"
+#include "host/HostClock.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor
+  * @param      pins ADC pins in scan order
+  * @param      count Number of pins, at most ADC_SCAN_MAX_CHANNELS
+  * @return     Nothing
+  ********************************************************************************************** */
+HostAdcScan::HostAdcScan(const uint8_t* pins, uint8_t count) {
+  this->count = count < ADC_SCAN_MAX_CHANNELS ? count : ADC_SCAN_MAX_CHANNELS;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+  }
+  this->scanning = false;
+  this->scanRateHz = 0;
+  this->startUs = 0;
+  this->scanIndex = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Setup the scan
+  * @return     true if a signal source is set and there is at least one pin
+  ********************************************************************************************** */
+bool HostAdcScan::setup() {
+  return HostAdc::source != nullptr && this->count > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Number of scanned pins
+  * @return     Channel count
+  ********************************************************************************************** */
+uint8_t HostAdcScan::channelCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Start timer-paced scanning
+  * @param      scanRateHz Scans per second
+  * @return     true if scanning started
+  ********************************************************************************************** */
+bool HostAdcScan::startScan(uint32_t scanRateHz) {
+  if (HostAdc::source == nullptr || scanRateHz == 0 || this->scanning ||
+      (uint64_t)scanRateHz * this->count * HOST_ADC_CONVERSION_US > 1000000) {
+    return false;
+  }
+  this->scanRateHz = scanRateHz;
+  this->startUs = HostClock::nowUs();
+  this->scanIndex = 0;
+  this->scanning = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Stop scanning
+  * @return     true if scanning was running
+  ********************************************************************************************** */
+bool HostAdcScan::stopScan() {
+  if (!this->scanning) {
+    return false;
+  }
+  this->scanning = false;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      De-interleave the scans completed so far
+  * @param      channels One destination array per channel
+  * @param      timestampsUs Scan times, may be nullptr
+  * @param      maxScans Capacity of every destination array
+  * @param      scansRead Number of scans stored
+  * @return     true if at least one scan was read
+  * @details    Like HostAdc::readBlock(): when no scan is due the clock advances to the next
+  *             one, and scans older than the simulated buffer are dropped.
+  ********************************************************************************************** */
+bool HostAdcScan::readScans(uint16_t* const* channels, uint32_t* timestampsUs, size_t maxScans,
+                            size_t& scansRead) {
+  scansRead = 0;
+  if (!this->scanning || channels == nullptr || maxScans == 0) {
+    return false;
+  }
+  uint64_t now = HostClock::nowUs();
+  if (scanTimeUs(this->scanIndex) > now) {
+    now = scanTimeUs(this->scanIndex);
+    HostClock::advanceTo(now);
+  }
+  uint64_t due = (now - this->startUs) * this->scanRateHz / 1000000 + 1;
+  uint64_t bufferScans = HOST_ADC_BUFFER_SAMPLES / this->count;
+  if (due - this->scanIndex > bufferScans) {
+    this->scanIndex = due - bufferScans;
+  }
+  while (this->scanIndex < due && scansRead < maxScans) {
+    uint64_t timeUs = scanTimeUs(this->scanIndex);
+    for (uint8_t c = 0; c < this->count; c++) {
+      channels[c][scansRead] = HostAdc::source(this->pins[c], timeUs + c * HOST_ADC_CONVERSION_US,
+                                               HostAdc::sourceContext) & 0x0FFF;
+    }
+    if (timestampsUs != nullptr) {
+      timestampsUs[scansRead] = (uint32_t)timeUs;
+    }
+    scansRead++;
+    this->scanIndex++;
+  }
+  return scansRead > 0;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Start time of a scan
+  * @param      index Scan index since startScan()
+  * @return     Time in microseconds
+  ********************************************************************************************** */
+uint64_t HostAdcScan::scanTimeUs(uint64_t index) const {
+  return this->startUs + (index * 1000000 + this->scanRateHz - 1) / this->scanRateHz;
+}
@@ -0,0 +1,145 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostArduino.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Minimal Arduino core replacement Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <poll.h>
+#include <unistd.h>
+#include "host/HostClock.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Global objects                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+HostSerialPort Serial;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Time functions                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+unsigned long millis() {
+  return (unsigned long)(HostClock::nowUs() / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)HostClock::nowUs();
+}
+
+void delay(unsigned long ms) {
+  HostClock::advance((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+  HostClock::advance(us);
+}
+
+void yield() {
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* HostSerialPort                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+void HostSerialPort::begin(unsigned long baudRate) {
+  (void)baudRate;
+  this->started = true;
+}
+
+void HostSerialPort::end() {
+  this->started = false;
+}
+
+HostSerialPort::operator bool() const {
+  return this->started;
+}
+
+size_t HostSerialPort::write(uint8_t value) {
+  return write(&value, 1);
+}
+
+size_t HostSerialPort::write(const uint8_t* data, size_t length) {
+  size_t total = 0;
+  while (total < length) {
+    ssize_t written = ::write(STDOUT_FILENO, data + total, length - total);
+    if (written <= 0) {
+      break;
+    }
+    total += (size_t)written;
+  }
+  return total;
+}
+
+size_t HostSerialPort::print(const char* text) {
+  return write((const uint8_t*)text, strlen(text));
+}
+
+size_t HostSerialPort::println(const char* text) {
+  return print(text) + println();
+}
+
+size_t HostSerialPort::println() {
+  return print("\r\n");
+}
+
+size_t HostSerialPort::printf(const char* format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length <= 0) {
+    return 0;
+  }
+  return write((const uint8_t*)buffer, (size_t)length < sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1);
+}
+
+int HostSerialPort::available() {
+  struct pollfd fd = { STDIN_FILENO, POLLIN, 0 };
+  return (poll(&fd, 1, 0) > 0 && (fd.revents & POLLIN)) ? 1 : 0;
+}
+
+int HostSerialPort::availableForWrite() {
+  return 128;
+}
+
+size_t HostSerialPort::readBytes(uint8_t* buffer, size_t length) {
+  ssize_t bytesRead = ::read(STDIN_FILENO, buffer, length);
+  return bytesRead > 0 ? (size_t)bytesRead : 0;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Entry point                                                                                   */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Host entry point, replaces the Arduino core main()
+  * @return     Process exit code
+  * @details    HOST_SIM_SECONDS bounds the run in simulated time. Applications own their loop
+  *             inside App::run(), so returning from setup() means the application stopped.
+  ********************************************************************************************** */
+int main() {
+  const char* simSeconds = getenv("HOST_SIM_SECONDS");
+  if (simSeconds != nullptr) {
+    HostClock::setLimit((uint64_t)(atof(simSeconds) * 1000000.0));
+  }
+  setup();
+  loop();
+  fflush(stdout);
+  return EXIT_SUCCESS;
+}
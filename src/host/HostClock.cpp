@@ -0,0 +1,85 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostClock.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Simulated clock Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostClock.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+uint64_t HostClock::timeUs = 0;
+uint64_t HostClock::limitUs = 0;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Get the current simulated time
+  * @return     Time since simulation start in microseconds
+  ********************************************************************************************** */
+uint64_t HostClock::nowUs() {
+  return timeUs;
+}
+
+/**************************************************************************************************
+  * @brief      Move simulated time forward
+  * @param      us Number of microseconds to advance
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostClock::advance(uint64_t us) {
+  advanceTo(timeUs + us);
+}
+
+/**************************************************************************************************
+  * @brief      Move simulated time forward up to an absolute point in time
+  * @param      timeUs Target time in microseconds, ignored if already in the past
+  * @return     Nothing
+  * @details    When a simulation limit is set and reached, the process exits cleanly so that
+  *             applications which never return from App::run() can still be profiled.
+  ********************************************************************************************** */
+void HostClock::advanceTo(uint64_t timeUs) {
+  if (timeUs > HostClock::timeUs) {
+    HostClock::timeUs = timeUs;
+  }
+  if (limitUs != 0 && HostClock::timeUs >= limitUs) {
+    fflush(stdout);
+    exit(EXIT_SUCCESS);
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Restart simulated time from zero
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostClock::reset() {
+  timeUs = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Set the simulated time at which the process terminates
+  * @param      limitUs End of simulation in microseconds, 0 to run forever
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostClock::setLimit(uint64_t limitUs) {
+  HostClock::limitUs = limitUs;
+}
@@ -0,0 +1,139 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostCoreTask.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host pinned thread Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostCoreTask.h"
+#include <chrono>
+#include <thread>
+#include <pthread.h>
+#include <sched.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for host core task
+  * @param      name Thread name, truncated to 15 characters by Linux
+  * @param      core CPU the thread is bound to, modulo the CPUs of the host
+  * @param      priority Ignored
+  * @return     Nothing
+  ********************************************************************************************** */
+HostCoreTask::HostCoreTask(const char* name, uint8_t core, uint8_t priority)
+  : running(false), steps(0), overruns(0) {
+  (void)priority;
+  this->name = name;
+  this->core = core;
+  this->step = nullptr;
+  this->context = nullptr;
+  this->periodUs = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Destructor, stops the thread
+  * @return     Nothing
+  ********************************************************************************************** */
+HostCoreTask::~HostCoreTask() {
+  stop();
+}
+
+/**************************************************************************************************
+  * @brief      Start the thread
+  * @param      step Function called every period
+  * @param      context Argument of step
+  * @param      periodUs Period in microseconds, 0 to call step back to back
+  * @return     true if the thread was started
+  ********************************************************************************************** */
+bool HostCoreTask::start(CoreTaskStep step, void* context, uint32_t periodUs) {
+  if (step == nullptr || this->thread.joinable()) {
+    return false;
+  }
+  this->step = step;
+  this->context = context;
+  this->periodUs = periodUs;
+  this->running.store(true);
+  this->thread = std::thread(&HostCoreTask::loop, this);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Ask the thread to leave its loop and join it
+  * @return     true if the thread was running
+  ********************************************************************************************** */
+bool HostCoreTask::stop() {
+  if (!this->thread.joinable()) {
+    return false;
+  }
+  this->running.store(false);
+  this->thread.join();
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Get the step and overrun counters
+  * @param[out] stats Counters since construction
+  * @return     true
+  ********************************************************************************************** */
+bool HostCoreTask::getStats(CoreTaskStats& stats) const {
+  stats.steps = this->steps.load(std::memory_order_relaxed);
+  stats.overruns = this->overruns.load(std::memory_order_relaxed);
+  return true;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Thread body: bind to the CPU, then step every period
+  * @return     Nothing
+  * @details    A wake time already passed is an overrun, and the schedule restarts from now
+  *             rather than running the missed periods back to back. Binding may fail in
+  *             restricted containers, the thread then runs unbound.
+  ********************************************************************************************** */
+void HostCoreTask::loop() {
+  unsigned cpus = std::thread::hardware_concurrency();
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpus > 0 ? this->core % cpus : 0, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  char shortName[16] = {};
+  for (size_t i = 0; i + 1 < sizeof(shortName) && this->name != nullptr && this->name[i]; i++) {
+    shortName[i] = this->name[i];
+  }
+  pthread_setname_np(pthread_self(), shortName);
+
+  std::chrono::microseconds period(this->periodUs);
+  auto wake = std::chrono::steady_clock::now();
+  while (this->running.load(std::memory_order_acquire)) {
+    this->step(this->context);
+    this->steps.fetch_add(1, std::memory_order_relaxed);
+    if (this->periodUs == 0) {
+      continue;
+    }
+    wake += period;
+    auto now = std::chrono::steady_clock::now();
+    if (wake <= now) {
+      this->overruns.fetch_add(1, std::memory_order_relaxed);
+      wake = now;
+    } else {
+      std::this_thread::sleep_until(wake);
+    }
+  }
+}
@@ -0,0 +1,168 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostGpio.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host GPIO Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostGpio.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+uint8_t HostGpio::levels[HOST_GPIO_PIN_COUNT] = {0};
+uint8_t HostGpio::modes[HOST_GPIO_PIN_COUNT] = {0};
+uint64_t HostGpio::switches[HOST_GPIO_PIN_COUNT] = {0};
+GpioCallback HostGpio::callbacks[HOST_GPIO_PIN_COUNT] = {nullptr};
+void* HostGpio::contexts[HOST_GPIO_PIN_COUNT] = {nullptr};
+uint8_t HostGpio::notifiedLevels[HOST_GPIO_PIN_COUNT] = {0};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Host GPIO
+  * @return     Nothing
+  ********************************************************************************************** */
+HostGpio::HostGpio(uint8_t pin, uint8_t mode) {
+  this->pin = pin;
+  this->mode = mode;
+}
+
+/**************************************************************************************************
+  * @brief      Setup GPIO pin
+  * @return     true if setup successful
+  ********************************************************************************************** */
+bool HostGpio::setup() {
+  if (this->pin < HOST_GPIO_PIN_COUNT) {
+    modes[this->pin] = this->mode;
+    if (this->mode == INPUT_PULLUP) {
+      levels[this->pin] = HIGH;
+    }
+    propagate();
+    return true;
+  }
+  return false;
+}
+
+/**************************************************************************************************
+  * @brief      Write to GPIO pin
+  * @return     true if write successful
+  ********************************************************************************************** */
+bool HostGpio::write(uint8_t state) {
+  if (this->pin < HOST_GPIO_PIN_COUNT && this->mode == OUTPUT) {
+    levels[this->pin] = state;
+    propagate();
+    return true;
+  }
+  return false;
+}
+
+/**************************************************************************************************
+  * @brief      Read from GPIO pin
+  * @return     true if read successful
+  ********************************************************************************************** */
+bool HostGpio::read(uint8_t& state) {
+  if (this->pin < HOST_GPIO_PIN_COUNT && (this->mode == INPUT || this->mode == INPUT_PULLUP)) {
+    state = resolve(this->pin);
+    return true;
+  }
+  return false;
+}
+
+/**************************************************************************************************
+  * @brief      Drive a simulated pin from outside, e.g. to press a button
+  * @param      pin GPIO pin
+  * @param      level LOW or HIGH
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostGpio::setLevel(uint8_t pin, uint8_t level) {
+  if (pin < HOST_GPIO_PIN_COUNT) {
+    levels[pin] = level;
+    propagate();
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Get the current level of a simulated pin
+  * @param      pin GPIO pin
+  * @return     LOW or HIGH, LOW for unknown pins
+  ********************************************************************************************** */
+uint8_t HostGpio::getLevel(uint8_t pin) {
+  return pin < HOST_GPIO_PIN_COUNT ? resolve(pin) : LOW;
+}
+
+/**************************************************************************************************
+  * @brief      Close or open a switch between two pins, e.g. a button matrix key
+  * @param      pinA Row pin
+  * @param      pinB Column pin
+  * @param      closed true to press, false to release
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostGpio::setSwitch(uint8_t pinA, uint8_t pinB, bool closed) {
+  if (pinA >= HOST_GPIO_PIN_COUNT || pinB >= HOST_GPIO_PIN_COUNT) {
+    return;
+  }
+  if (closed) {
+    switches[pinA] |= (uint64_t)1 << pinB;
+    switches[pinB] |= (uint64_t)1 << pinA;
+  } else {
+    switches[pinA] &= ~((uint64_t)1 << pinB);
+    switches[pinB] &= ~((uint64_t)1 << pinA);
+  }
+  propagate();
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Level seen on a pin
+  * @param      pin GPIO pin
+  * @return     Output level, or LOW if a closed switch connects the input to an output driven
+  *             LOW, otherwise the external level
+  ********************************************************************************************** */
+uint8_t HostGpio::resolve(uint8_t pin) {
+  if (modes[pin] == OUTPUT) {
+    return levels[pin];
+  }
+  for (uint8_t other = 0; other < HOST_GPIO_PIN_COUNT; other++) {
+    if ((switches[pin] & ((uint64_t)1 << other)) != 0 && modes[other] == OUTPUT &&
+        levels[other] == LOW) {
+      return LOW;
+    }
+  }
+  return levels[pin];
+}
+
+/**************************************************************************************************
+  * @brief      Call the change handler of every pin whose level changed
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostGpio::propagate() {
+  for (uint8_t pin = 0; pin < HOST_GPIO_PIN_COUNT; pin++) {
+    if (callbacks[pin] == nullptr) {
+      continue;
+    }
+    uint8_t level = resolve(pin);
+    if (level != notifiedLevels[pin]) {
+      notifiedLevels[pin] = level;
+      callbacks[pin](contexts[pin]);
+    }
+  }
+}
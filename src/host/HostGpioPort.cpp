@@ -0,0 +1,136 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostGpioPort.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host GPIO Port Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostGpioPort.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Host GPIO port
+  * @param      pins Pins of the port, bit i of the masks is pins[i]
+  * @param      count Number of pins, at most GPIO_PORT_MAX_PINS
+  * @param      mode Mode of every pin
+  * @return     Nothing
+  ********************************************************************************************** */
+HostGpioPort::HostGpioPort(const uint8_t* pins, uint8_t count, uint8_t mode) {
+  this->count = count < GPIO_PORT_MAX_PINS ? count : GPIO_PORT_MAX_PINS;
+  this->mode = mode;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Setup every pin of the port
+  * @return     true if every pin is simulated
+  ********************************************************************************************** */
+bool HostGpioPort::setup() {
+  for (uint8_t i = 0; i < this->count; i++) {
+    if (this->pins[i] >= HOST_GPIO_PIN_COUNT) {
+      return false;
+    }
+    HostGpio::modes[this->pins[i]] = this->mode;
+    if (this->mode == INPUT_PULLUP) {
+      HostGpio::levels[this->pins[i]] = HIGH;
+    }
+  }
+  HostGpio::propagate();
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Number of pins in the port
+  * @return     Pin count
+  ********************************************************************************************** */
+uint8_t HostGpioPort::pinCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Drive several output pins at once
+  * @param      mask Pins to drive
+  * @param      levels New level of each pin in mask
+  * @return     true if the port is an output
+  ********************************************************************************************** */
+bool HostGpioPort::write(uint32_t mask, uint32_t levels) {
+  if (this->mode != OUTPUT) {
+    return false;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    if ((mask & (1u << i)) != 0) {
+      HostGpio::levels[this->pins[i]] = (levels & (1u << i)) != 0 ? HIGH : LOW;
+    }
+  }
+  HostGpio::propagate();
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Sample every pin of the port
+  * @param[out] levels Bit i is the level of pins[i]
+  * @return     true if the port is an input
+  ********************************************************************************************** */
+bool HostGpioPort::read(uint32_t& levels) {
+  if (this->mode != INPUT && this->mode != INPUT_PULLUP) {
+    return false;
+  }
+  levels = 0;
+  for (uint8_t i = 0; i < this->count; i++) {
+    levels |= (uint32_t)(HostGpio::resolve(this->pins[i]) == HIGH) << i;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Call a function when any pin of an input port changes level
+  * @param      callback Handler, called from the simulation call that changed the level
+  * @param      context Passed to the handler
+  * @return     true if the interrupts were attached
+  ********************************************************************************************** */
+bool HostGpioPort::attachChangeInterrupt(GpioCallback callback, void* context) {
+  if (this->mode == OUTPUT || callback == nullptr) {
+    return false;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    uint8_t pin = this->pins[i];
+    HostGpio::notifiedLevels[pin] = HostGpio::resolve(pin);
+    HostGpio::contexts[pin] = context;
+    HostGpio::callbacks[pin] = callback;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Remove the level change interrupts
+  * @return     true if the port is an input
+  ********************************************************************************************** */
+bool HostGpioPort::detachChangeInterrupt() {
+  if (this->mode == OUTPUT) {
+    return false;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    HostGpio::callbacks[this->pins[i]] = nullptr;
+    HostGpio::contexts[this->pins[i]] = nullptr;
+  }
+  return true;
+}
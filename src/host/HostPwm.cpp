@@ -0,0 +1,72 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostPwm.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host PWM Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostPwm.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+uint8_t HostPwm::duties[HOST_PWM_PIN_COUNT] = {0};
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Host PWM
+  * @return     Nothing
+  ********************************************************************************************** */
+HostPwm::HostPwm(uint8_t pin) {
+  this->pin = pin;
+}
+
+/**************************************************************************************************
+  * @brief      Setup PWM pin
+  * @return     true if setup successful
+  ********************************************************************************************** */
+bool HostPwm::setup() {
+  if (this->pin < HOST_PWM_PIN_COUNT) {
+    duties[this->pin] = 0;
+    return true;
+  }
+  return false;
+}
+
+/**************************************************************************************************
+  * @brief      Write PWM duty cycle
+  * @return     true if write successful
+  ********************************************************************************************** */
+bool HostPwm::write(uint8_t dutyCycle) {
+  if (this->pin < HOST_PWM_PIN_COUNT) {
+    duties[this->pin] = dutyCycle;
+    return true;
+  }
+  return false;
+}
+
+/**************************************************************************************************
+  * @brief      Get the last duty cycle written to a pin
+  * @param      pin PWM pin
+  * @return     Duty cycle, 0 for unknown pins
+  ********************************************************************************************** */
+uint8_t HostPwm::getDuty(uint8_t pin) {
+  return pin < HOST_PWM_PIN_COUNT ? duties[pin] : 0;
+}
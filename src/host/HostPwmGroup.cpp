@@ -0,0 +1,107 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostPwmGroup.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host PWM group Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostPwmGroup.h"
+#include "host/HostClock.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Host PWM group
+  * @param      pins Output pins, channel i drives pins[i]
+  * @param      count Number of pins, at most HOST_PWM_GROUP_MAX_CHANNELS
+  * @return     Nothing
+  ********************************************************************************************** */
+HostPwmGroup::HostPwmGroup(const uint8_t* pins, uint8_t count) {
+  this->count = count < HOST_PWM_GROUP_MAX_CHANNELS ? count : HOST_PWM_GROUP_MAX_CHANNELS;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+    this->staged[i] = 0;
+  }
+  this->commitCount = 0;
+  this->lastCommitUs = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Setup PWM pins, outputs start low
+  * @return     true if every pin exists
+  ********************************************************************************************** */
+bool HostPwmGroup::setup() {
+  for (uint8_t i = 0; i < this->count; i++) {
+    if (this->pins[i] >= HOST_PWM_PIN_COUNT) {
+      return false;
+    }
+    this->staged[i] = 0;
+    HostPwm::duties[this->pins[i]] = 0;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Number of channels in the group
+  * @return     Channel count
+  ********************************************************************************************** */
+uint8_t HostPwmGroup::channelCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Stage a duty cycle, the output keeps its current duty until commit()
+  * @return     true if the channel exists
+  ********************************************************************************************** */
+bool HostPwmGroup::stage(uint8_t channel, uint8_t dutyCycle) {
+  if (channel >= this->count) {
+    return false;
+  }
+  this->staged[channel] = dutyCycle;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Apply every staged duty cycle at the current simulated time
+  * @return     true if all channels were updated
+  ********************************************************************************************** */
+bool HostPwmGroup::commit() {
+  for (uint8_t i = 0; i < this->count; i++) {
+    HostPwm::duties[this->pins[i]] = this->staged[i];
+  }
+  this->commitCount++;
+  this->lastCommitUs = HostClock::nowUs();
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Number of commits since construction
+  * @return     Commit count
+  ********************************************************************************************** */
+uint32_t HostPwmGroup::getCommitCount() const {
+  return this->commitCount;
+}
+
+/**************************************************************************************************
+  * @brief      Simulated time of the last commit
+  * @return     Time in microseconds, 0 before the first commit
+  ********************************************************************************************** */
+uint64_t HostPwmGroup::getLastCommitUs() const {
+  return this->lastCommitUs;
+}
@@ -0,0 +1,171 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostSerial.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host Serial Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostSerial.h"
+#include "host/HostClock.h"
+#include <poll.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Static members                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+int HostSerial::rxFd = STDIN_FILENO;
+int HostSerial::txFd = STDOUT_FILENO;
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Host Serial
+  * @return     Nothing
+  ********************************************************************************************** */
+HostSerial::HostSerial(unsigned long baudRate) {
+  this->baudRate = baudRate;
+  this->txIdleUs = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Setup Serial communication
+  * @return     true if setup successful
+  ********************************************************************************************** */
+bool HostSerial::setup() {
+  return this->baudRate > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Write spans to the attached file descriptor with one gather write
+  * @return     true if all bytes were written
+  * @details    The UART is simulated as a HOST_SERIAL_TX_FIFO byte FIFO shifting out 10 bits
+  *             per byte. Like Serial.write() on target, the call returns at once while the
+  *             bytes fit the FIFO, otherwise the simulated clock advances until the last one
+  *             enters it. A negative descriptor discards the data but keeps the timing.
+  ********************************************************************************************** */
+bool HostSerial::writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) {
+  bytesWritten = 0;
+  size_t length = ITransport::totalLength(spans, count);
+  if (spans == nullptr || length == 0 || this->baudRate == 0) {
+    return false;
+  }
+  if (txFd < 0) {
+    bytesWritten = length;
+  }
+  struct iovec vectors[HOST_SERIAL_MAX_SPANS];
+  size_t next = 0;
+  size_t pendingCount = 0;
+  struct iovec* pending = vectors;
+  while (bytesWritten < length) {
+    if (pendingCount == 0) {
+      for (pending = vectors; pendingCount < HOST_SERIAL_MAX_SPANS && next < count; next++) {
+        vectors[pendingCount].iov_base = (void*)spans[next].data;
+        vectors[pendingCount++].iov_len = spans[next].length;
+      }
+    }
+    ssize_t written = ::writev(txFd, pending, (int)pendingCount);
+    if (written <= 0) {
+      break;
+    }
+    bytesWritten += (size_t)written;
+    // Skip what went out, a short write resumes inside a span
+    size_t skipped = (size_t)written;
+    while (pendingCount > 0 && skipped >= pending->iov_len) {
+      skipped -= pending->iov_len;
+      pending++;
+      pendingCount--;
+    }
+    if (pendingCount > 0) {
+      pending->iov_base = (uint8_t*)pending->iov_base + skipped;
+      pending->iov_len -= skipped;
+    }
+  }
+  uint64_t nowUs = HostClock::nowUs();
+  this->txIdleUs = (this->txIdleUs > nowUs ? this->txIdleUs : nowUs) + transmitUs(bytesWritten);
+  uint64_t fifoUs = transmitUs(HOST_SERIAL_TX_FIFO);
+  if (this->txIdleUs > nowUs + fifoUs) {
+    HostClock::advanceTo(this->txIdleUs - fifoUs);
+  }
+  return bytesWritten == length;
+}
+
+/**************************************************************************************************
+  * @brief      Read the data already pending on the attached file descriptor
+  * @return     true if at least one byte was read
+  ********************************************************************************************** */
+bool HostSerial::readData(uint8_t* buffer, size_t length, size_t& bytesRead) {
+  if (buffer == nullptr || length == 0 || rxFd < 0) {
+    return false;
+  }
+  struct pollfd fd = { rxFd, POLLIN, 0 };
+  if (poll(&fd, 1, 0) <= 0 || !(fd.revents & POLLIN)) {
+    return false;
+  }
+  ssize_t received = ::read(rxFd, buffer, length);
+  bytesRead = received > 0 ? (size_t)received : 0;
+  return bytesRead > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Free space in the simulated transmit FIFO
+  * @param      space Bytes that can be written without advancing the clock
+  * @return     true if the port is configured
+  ********************************************************************************************** */
+bool HostSerial::availableForWrite(size_t& space) {
+  if (this->baudRate == 0) {
+    return false;
+  }
+  uint64_t nowUs = HostClock::nowUs();
+  uint64_t pendingUs = this->txIdleUs > nowUs ? this->txIdleUs - nowUs : 0;
+  uint64_t pending = (pendingUs * this->baudRate + 10 * 1000000 - 1) / (10 * 1000000);
+  space = pending < HOST_SERIAL_TX_FIFO ? HOST_SERIAL_TX_FIFO - (size_t)pending : 0;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Nothing to do, the simulated FIFO drains with the clock
+  * @return     true if the port is configured
+  ********************************************************************************************** */
+bool HostSerial::update() {
+  return this->baudRate > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Redirect every host serial port, e.g. to a pty or a file
+  * @param      rxFd Descriptor read by readData(), negative to disable input
+  * @param      txFd Descriptor written by writeSpans(), negative to discard output
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostSerial::attach(int rxFd, int txFd) {
+  HostSerial::rxFd = rxFd;
+  HostSerial::txFd = txFd;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Time the UART needs to shift bytes out
+  * @param      bytes Number of bytes, 10 bits each
+  * @return     Duration in us
+  ********************************************************************************************** */
+uint64_t HostSerial::transmitUs(size_t bytes) const {
+  return (uint64_t)bytes * 10 * 1000000 / this->baudRate;
+}
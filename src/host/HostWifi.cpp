@@ -0,0 +1,202 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : HostWifi.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : Host UDP socket Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {native}
+ * @compiler : {gcc}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "host/HostWifi.h"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for Host WiFi
+  * @param      localPort UDP port to listen on, on the loopback interface
+  * @param      remotePort UDP port of the receiver, on the loopback interface
+  * @return     Nothing
+  ********************************************************************************************** */
+HostWifi::HostWifi(uint16_t localPort, uint16_t remotePort) : batch(WIFI_FLUSH_DEADLINE_US) {
+  this->localPort = localPort;
+  this->remotePort = remotePort;
+  this->remoteAddress = htonl(INADDR_LOOPBACK);
+  this->socketFd = -1;
+  this->receivedLength = 0;
+  this->receivedOffset = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Destructor, closes the socket
+  * @return     Nothing
+  ********************************************************************************************** */
+HostWifi::~HostWifi() {
+  if (this->socketFd >= 0) {
+    close(this->socketFd);
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Open a non-blocking UDP socket bound to the local port
+  * @return     true if the socket is ready
+  ********************************************************************************************** */
+bool HostWifi::setup() {
+  if (this->socketFd >= 0) {
+    return true;
+  }
+  this->socketFd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (this->socketFd < 0) {
+    return false;
+  }
+  struct sockaddr_in local;
+  memset(&local, 0, sizeof(local));
+  local.sin_family = AF_INET;
+  local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  local.sin_port = htons(this->localPort);
+  if (fcntl(this->socketFd, F_SETFL, O_NONBLOCK) != 0 ||
+      bind(this->socketFd, (struct sockaddr*)&local, sizeof(local)) != 0) {
+    close(this->socketFd);
+    this->socketFd = -1;
+    return false;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Gather a frame into the current datagram
+  * @param      spans Parts of the frame, kept whole in one datagram
+  * @param      count Number of spans
+  * @param      bytesWritten Frame length if the frame was accepted
+  * @return     true if the frame was accepted
+  * @details    Sends the current datagram first when the frame does not fit, and right after
+  *             when the flush deadline is reached.
+  ********************************************************************************************** */
+bool HostWifi::writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) {
+  bytesWritten = 0;
+  size_t length = ITransport::totalLength(spans, count);
+  if (this->socketFd < 0 || spans == nullptr || length == 0 || length > DATAGRAM_BATCH_BYTES) {
+    return false;
+  }
+  uint32_t nowUs = micros();
+  if (!this->batch.append(spans, count, nowUs)) {
+    sendBatch();
+    this->batch.append(spans, count, nowUs);
+  }
+  if (this->batch.due(nowUs)) {
+    sendBatch();
+  }
+  bytesWritten = length;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Read received datagram bytes, never waits
+  * @param      buffer Destination
+  * @param      length Size of the destination
+  * @param      bytesRead Number of bytes read
+  * @return     true if at least one byte was read
+  * @details    A datagram larger than the buffer is returned over several calls. Its sender
+  *             becomes the destination of the next datagrams.
+  ********************************************************************************************** */
+bool HostWifi::readData(uint8_t* buffer, size_t length, size_t& bytesRead) {
+  if (this->socketFd < 0 || buffer == nullptr || length == 0) {
+    return false;
+  }
+  if (this->receivedOffset == this->receivedLength) {
+    struct sockaddr_in sender;
+    socklen_t senderLength = sizeof(sender);
+    ssize_t received = recvfrom(this->socketFd, this->received, sizeof(this->received),
+                                MSG_DONTWAIT, (struct sockaddr*)&sender, &senderLength);
+    if (received <= 0) {
+      return false;
+    }
+    this->receivedLength = (size_t)received;
+    this->receivedOffset = 0;
+    this->remoteAddress = sender.sin_addr.s_addr;
+    this->remotePort = ntohs(sender.sin_port);
+  }
+  size_t available = this->receivedLength - this->receivedOffset;
+  bytesRead = length < available ? length : available;
+  memcpy(buffer, &this->received[this->receivedOffset], bytesRead);
+  this->receivedOffset += bytesRead;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Largest frame writeSpans() accepts without waiting
+  * @param      space DATAGRAM_BATCH_BYTES, a frame that does not fit sends the datagram first
+  * @return     true if the link is up
+  ********************************************************************************************** */
+bool HostWifi::availableForWrite(size_t& space) {
+  space = DATAGRAM_BATCH_BYTES;
+  return this->socketFd >= 0;
+}
+
+/**************************************************************************************************
+  * @brief      Send the current datagram once its flush deadline is reached
+  * @return     false if the datagram was refused by the socket
+  ********************************************************************************************** */
+bool HostWifi::update() {
+  return !this->batch.due(micros()) || sendBatch();
+}
+
+/**************************************************************************************************
+  * @brief      Change the flush deadline set by WIFI_FLUSH_DEADLINE_US
+  * @param      deadlineUs Longest time a frame waits for others, 0 to send every frame alone
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostWifi::setFlushDeadline(uint32_t deadlineUs) {
+  this->batch.setDeadline(deadlineUs);
+}
+
+/**************************************************************************************************
+  * @brief      Datagram counters
+  * @param      stats Receives the counters
+  * @return     Nothing
+  ********************************************************************************************** */
+void HostWifi::getStats(DatagramStats& stats) const {
+  this->batch.getStats(stats);
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Send the current datagram and start a new one
+  * @return     true if the socket accepted it, a full socket buffer drops it
+  ********************************************************************************************** */
+bool HostWifi::sendBatch() {
+  if (this->batch.length() == 0) {
+    return true;
+  }
+  struct sockaddr_in remote;
+  memset(&remote, 0, sizeof(remote));
+  remote.sin_family = AF_INET;
+  remote.sin_addr.s_addr = this->remoteAddress;
+  remote.sin_port = htons(this->remotePort);
+  ssize_t sent = sendto(this->socketFd, this->batch.data(), this->batch.length(), MSG_DONTWAIT,
+                        (struct sockaddr*)&remote, sizeof(remote));
+  bool success = sent == (ssize_t)this->batch.length();
+  this->batch.sent(success);
+  return success;
+}
@@ -4,6 +4,10 @@
 #include "FullArm.h"
 #elif defined(APP_DATASET_GENERATION)
 #include "DatasetGeneration.h"
+#elif defined(APP_BENCHMARK)
+#include "Benchmark.h"
+#elif defined(APP_REPLAY)
+#include "Replay.h"
 #else
 #error "No application selected"
 #endif
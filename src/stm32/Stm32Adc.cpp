@@ -31,6 +31,9 @@
   ********************************************************************************************** */
 Stm32Adc::Stm32Adc(uint8_t pin) {
   this->pin = pin;
+  this->continuous = false;
+  this->periodUs = 0;
+  this->nextSampleUs = 0;
 }
 
 /**************************************************************************************************
@@ -48,9 +51,57 @@ bool Stm32Adc::setup() {
   * @return     ADC reading
   ********************************************************************************************** */
 bool Stm32Adc::read(uint16_t& value) {
-  if (this->pin >= 0) {
+  if (this->pin >= 0 && !this->continuous) {
     value = analogRead(this->pin);
     return true;
   }
   return false;
-} 
\ No newline at end of file
+} 
+
+/**************************************************************************************************
+  * @brief      Start timer paced sampling
+  * @param      sampleRateHz Sampling frequency
+  * @return     true if continuous mode started
+  * @details    Conversions are paced on micros() and taken when readBlock() is polled, so the
+  *             caller must poll at least once per sample period to avoid timing jitter.
+  ********************************************************************************************** */
+bool Stm32Adc::startContinuous(uint32_t sampleRateHz) {
+  if (this->continuous || sampleRateHz == 0 || sampleRateHz > 1000000) {
+    return false;
+  }
+  this->periodUs = 1000000 / sampleRateHz;
+  this->nextSampleUs = micros();
+  this->continuous = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Stop timer paced sampling
+  * @return     true if continuous mode was running
+  ********************************************************************************************** */
+bool Stm32Adc::stopContinuous() {
+  if (!this->continuous) {
+    return false;
+  }
+  this->continuous = false;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Read the samples due since the previous call
+  * @param      dst Destination buffer
+  * @param      n Capacity of dst in samples
+  * @param      samplesRead Number of samples stored in dst
+  * @return     true if at least one sample was read
+  ********************************************************************************************** */
+bool Stm32Adc::readBlock(uint16_t* dst, size_t n, size_t& samplesRead) {
+  samplesRead = 0;
+  if (!this->continuous || dst == nullptr || n == 0) {
+    return false;
+  }
+  while (samplesRead < n && (int32_t)(micros() - this->nextSampleUs) >= 0) {
+    dst[samplesRead++] = analogRead(this->pin);
+    this->nextSampleUs += this->periodUs;
+  }
+  return samplesRead > 0;
+}
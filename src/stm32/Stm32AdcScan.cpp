@@ -0,0 +1,118 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Stm32AdcScan.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : STM32 multi-channel ADC scan Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "Stm32AdcScan.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor
+  * @param      pins ADC pins in scan order
+  * @param      count Number of pins, at most ADC_SCAN_MAX_CHANNELS
+  * @return     Nothing
+  ********************************************************************************************** */
+Stm32AdcScan::Stm32AdcScan(const uint8_t* pins, uint8_t count) {
+  this->count = count < ADC_SCAN_MAX_CHANNELS ? count : ADC_SCAN_MAX_CHANNELS;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+  }
+  this->scanning = false;
+  this->periodUs = 0;
+  this->nextScanUs = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Setup the ADC pins
+  * @return     true if there is at least one pin
+  ********************************************************************************************** */
+bool Stm32AdcScan::setup() {
+  for (uint8_t i = 0; i < this->count; i++) {
+    pinMode(this->pins[i], INPUT);
+  }
+  analogReadResolution(12);
+  return this->count > 0;
+}
+
+/**************************************************************************************************
+  * @brief      Number of scanned pins
+  * @return     Channel count
+  ********************************************************************************************** */
+uint8_t Stm32AdcScan::channelCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Start timer paced scanning
+  * @param      scanRateHz Scans per second
+  * @return     true if scanning started
+  * @details    Like Stm32Adc, scans are paced on micros() and converted when readScans() is
+  *             polled, one analogRead() per pin.
+  ********************************************************************************************** */
+bool Stm32AdcScan::startScan(uint32_t scanRateHz) {
+  if (this->scanning || scanRateHz == 0 || scanRateHz > 1000000) {
+    return false;
+  }
+  this->periodUs = 1000000 / scanRateHz;
+  this->nextScanUs = micros();
+  this->scanning = true;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Stop scanning
+  * @return     true if scanning was running
+  ********************************************************************************************** */
+bool Stm32AdcScan::stopScan() {
+  if (!this->scanning) {
+    return false;
+  }
+  this->scanning = false;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Convert the scans due since the previous call
+  * @param      channels One destination array per channel
+  * @param      timestampsUs Scan times, may be nullptr
+  * @param      maxScans Capacity of every destination array
+  * @param      scansRead Number of scans stored
+  * @return     true if at least one scan was read
+  ********************************************************************************************** */
+bool Stm32AdcScan::readScans(uint16_t* const* channels, uint32_t* timestampsUs, size_t maxScans,
+                             size_t& scansRead) {
+  scansRead = 0;
+  if (!this->scanning || channels == nullptr || maxScans == 0) {
+    return false;
+  }
+  while (scansRead < maxScans && (int32_t)(micros() - this->nextScanUs) >= 0) {
+    for (uint8_t c = 0; c < this->count; c++) {
+      channels[c][scansRead] = analogRead(this->pins[c]);
+    }
+    if (timestampsUs != nullptr) {
+      timestampsUs[scansRead] = this->nextScanUs;
+    }
+    scansRead++;
+    this->nextScanUs += this->periodUs;
+  }
+  return scansRead > 0;
+}
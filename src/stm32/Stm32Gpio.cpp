@@ -60,9 +60,20 @@ bool Stm32Gpio::write(uint8_t state) {
   * @return     true if read successful
   ********************************************************************************************** */
 bool Stm32Gpio::read(uint8_t& state) {
-  if (this->pin >= 0 && this->mode == INPUT) {
+  if (this->pin >= 0 && this->isInput()) {
     state = digitalRead(this->pin);
     return true;
   }
   return false;
-} 
\ No newline at end of file
+} 
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Check whether the pin was configured as an input, with or without pull resistor
+  * @return     true for INPUT, INPUT_PULLUP and INPUT_PULLDOWN
+  ********************************************************************************************** */
+bool Stm32Gpio::isInput() const {
+  return this->mode == INPUT || this->mode == INPUT_PULLUP || this->mode == INPUT_PULLDOWN;
+}
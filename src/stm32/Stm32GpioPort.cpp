@@ -0,0 +1,158 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Stm32GpioPort.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : STM32 GPIO Port Implementation
+ *
+ **************************************************************************************************
+ *
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ *
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "stm32/Stm32GpioPort.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for STM32 GPIO port
+  * @param      pins Pins of the port, bit i of the masks is pins[i]
+  * @param      count Number of pins, at most GPIO_PORT_MAX_PINS
+  * @param      mode Mode of every pin
+  * @return     Nothing
+  ********************************************************************************************** */
+Stm32GpioPort::Stm32GpioPort(const uint8_t* pins, uint8_t count, uint8_t mode) {
+  this->count = count < GPIO_PORT_MAX_PINS ? count : GPIO_PORT_MAX_PINS;
+  this->mode = mode;
+  this->idr = nullptr;
+  this->bsrr = nullptr;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+    this->bits[i] = 0;
+  }
+}
+
+/**************************************************************************************************
+  * @brief      Setup every pin and locate the GPIO block
+  * @return     true if all pins are on the same GPIO block
+  ********************************************************************************************** */
+bool Stm32GpioPort::setup() {
+  if (this->count == 0) {
+    return false;
+  }
+  GPIO_TypeDef* port = digitalPinToPort(this->pins[0]);
+  for (uint8_t i = 0; i < this->count; i++) {
+    if (digitalPinToPort(this->pins[i]) != port) {
+      return false;
+    }
+    this->bits[i] = (uint16_t)digitalPinToBitMask(this->pins[i]);
+    pinMode(this->pins[i], this->mode);
+  }
+  this->idr = &port->IDR;
+  this->bsrr = &port->BSRR;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Number of pins in the port
+  * @return     Pin count
+  ********************************************************************************************** */
+uint8_t Stm32GpioPort::pinCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Drive several output pins at once
+  * @param      mask Pins to drive
+  * @param      levels New level of each pin in mask
+  * @return     true if the port is an output
+  ********************************************************************************************** */
+bool Stm32GpioPort::write(uint32_t mask, uint32_t levels) {
+  if (this->bsrr == nullptr || this->mode != OUTPUT) {
+    return false;
+  }
+  uint32_t set = 0;
+  uint32_t reset = 0;
+  for (uint8_t i = 0; i < this->count; i++) {
+    if ((mask & (1u << i)) == 0) {
+      continue;
+    }
+    if ((levels & (1u << i)) != 0) {
+      set |= this->bits[i];
+    } else {
+      reset |= this->bits[i];
+    }
+  }
+  *this->bsrr = set | (reset << 16);
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Sample every pin of the port
+  * @param[out] levels Bit i is the level of pins[i]
+  * @return     true if the port is an input
+  ********************************************************************************************** */
+bool Stm32GpioPort::read(uint32_t& levels) {
+  if (this->idr == nullptr || !this->isInput()) {
+    return false;
+  }
+  uint32_t idr = *this->idr;
+  levels = 0;
+  for (uint8_t i = 0; i < this->count; i++) {
+    levels |= (uint32_t)((idr & this->bits[i]) != 0) << i;
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Call a function when any pin of an input port changes level
+  * @param      callback Interrupt handler
+  * @param      context Passed to the handler
+  * @return     true if the interrupts were attached
+  ********************************************************************************************** */
+bool Stm32GpioPort::attachChangeInterrupt(GpioCallback callback, void* context) {
+  if (!this->isInput() || callback == nullptr) {
+    return false;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    attachInterrupt(digitalPinToInterrupt(this->pins[i]),
+                    [callback, context]() { callback(context); }, CHANGE);
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Remove the level change interrupts
+  * @return     true if the port is an input
+  ********************************************************************************************** */
+bool Stm32GpioPort::detachChangeInterrupt() {
+  if (!this->isInput()) {
+    return false;
+  }
+  for (uint8_t i = 0; i < this->count; i++) {
+    detachInterrupt(digitalPinToInterrupt(this->pins[i]));
+  }
+  return true;
+}
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Private methods                                                                               */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Check whether the port was configured as an input, with or without pull resistor
+  * @return     true for INPUT, INPUT_PULLUP and INPUT_PULLDOWN
+  ********************************************************************************************** */
+bool Stm32GpioPort::isInput() const {
+  return this->mode == INPUT || this->mode == INPUT_PULLUP || this->mode == INPUT_PULLDOWN;
+}
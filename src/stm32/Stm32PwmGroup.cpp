@@ -0,0 +1,92 @@
+/**
+ **************************************************************************************************
+ *
+ * @file    : Stm32PwmGroup.cpp
+ * @author  : Oussama Darouez
+ * @version : 1.0
+ * @date    : October 2026
+ * @brief   : STM32 PWM group Implementation
+ * 
+ **************************************************************************************************
+ * 
+ * @project  : {BionicArm}
+ * @board    : {esp32dev}
+ * @compiler : {gcc-arm-none-eabi}
+ * 
+ **************************************************************************************************
+ *
+ */
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Includes                                                                                      */
+/*-----------------------------------------------------------------------------------------------*/
+#include "stm32/Stm32PwmGroup.h"
+
+/*-----------------------------------------------------------------------------------------------*/
+/* Public methods                                                                                */
+/*-----------------------------------------------------------------------------------------------*/
+/**************************************************************************************************
+  * @brief      Constructor for STM32 PWM group
+  * @param      pins Output pins, channel i drives pins[i]
+  * @param      count Number of pins, at most STM32_PWM_GROUP_MAX_CHANNELS
+  * @return     Nothing
+  ********************************************************************************************** */
+Stm32PwmGroup::Stm32PwmGroup(const uint8_t* pins, uint8_t count) {
+  this->count = count < STM32_PWM_GROUP_MAX_CHANNELS ? count : STM32_PWM_GROUP_MAX_CHANNELS;
+  for (uint8_t i = 0; i < this->count; i++) {
+    this->pins[i] = pins[i];
+    this->staged[i] = 0;
+  }
+  this->dirty = 0;
+}
+
+/**************************************************************************************************
+  * @brief      Setup PWM pins, outputs start low
+  * @return     true if setup successful
+  ********************************************************************************************** */
+bool Stm32PwmGroup::setup() {
+  for (uint8_t i = 0; i < this->count; i++) {
+    pinMode(this->pins[i], OUTPUT);
+    analogWrite(this->pins[i], 0);
+    this->staged[i] = 0;
+  }
+  this->dirty = 0;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Number of channels in the group
+  * @return     Channel count
+  ********************************************************************************************** */
+uint8_t Stm32PwmGroup::channelCount() const {
+  return this->count;
+}
+
+/**************************************************************************************************
+  * @brief      Stage a duty cycle, the output keeps its current duty until commit()
+  * @return     true if the channel exists
+  ********************************************************************************************** */
+bool Stm32PwmGroup::stage(uint8_t channel, uint8_t dutyCycle) {
+  if (channel >= this->count) {
+    return false;
+  }
+  if (this->staged[channel] != dutyCycle) {
+    this->staged[channel] = dutyCycle;
+    this->dirty |= (uint16_t)(1u << channel);
+  }
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Apply every staged duty cycle, unchanged channels are not touched
+  * @return     true if all channels were updated
+  ********************************************************************************************** */
+bool Stm32PwmGroup::commit() {
+  for (uint8_t i = 0; i < this->count; i++) {
+    if (this->dirty & (1u << i)) {
+      analogWrite(this->pins[i], this->staged[i]);
+    }
+  }
+  this->dirty = 0;
+  return true;
+}
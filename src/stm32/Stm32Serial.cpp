@@ -46,18 +46,28 @@ bool Stm32Serial::setup() {
 }
 
 /**************************************************************************************************
-  * @brief      Write data to Serial
-  * @param      data Data buffer to write
-  * @param      length Length of data
+  * @brief      Write spans to Serial, one after the other
+  * @param      spans Buffers to write, in order
+  * @param      count Number of spans
   * @param      bytesWritten Reference to store number of bytes written
-  * @return     true if write successful, false otherwise
+  * @return     true if every byte was written, false otherwise
   ********************************************************************************************** */
-bool Stm32Serial::writeData(const uint8_t* data, size_t length, size_t& bytesWritten) {
-  if (data != nullptr && length > 0) {
-    bytesWritten = Serial.write(data, length);
-    return bytesWritten == length;
+bool Stm32Serial::writeSpans(const TransportSpan* spans, size_t count, size_t& bytesWritten) {
+  bytesWritten = 0;
+  if (spans == nullptr || count == 0) {
+    return false;
   }
-  return false;
+  for (size_t i = 0; i < count; i++) {
+    if (spans[i].data == nullptr) {
+      return false;
+    }
+    size_t written = Serial.write(spans[i].data, spans[i].length);
+    bytesWritten += written;
+    if (written < spans[i].length) {
+      return false;
+    }
+  }
+  return bytesWritten > 0;
 }
 
 /**************************************************************************************************
@@ -66,11 +76,34 @@ bool Stm32Serial::writeData(const uint8_t* data, size_t length, size_t& bytesWri
   * @param      length Maximum length to read
   * @param      bytesRead Reference to store number of bytes read
   * @return     true if read successful, false otherwise
+  * @details    Only takes the bytes already received, readBytes() would otherwise wait up to the
+  *             Stream timeout for the rest of the buffer.
   ********************************************************************************************** */
 bool Stm32Serial::readData(uint8_t* buffer, size_t length, size_t& bytesRead) {
-  if (buffer != nullptr && length > 0 && Serial.available()) {
-    bytesRead = Serial.readBytes(buffer, length);
+  bytesRead = 0;
+  int available = Serial.available();
+  if (buffer != nullptr && length > 0 && available > 0) {
+    bytesRead = Serial.readBytes(buffer, length < (size_t)available ? length : (size_t)available);
     return bytesRead > 0;
   }
   return false;
-} 
\ No newline at end of file
+}
+
+/**************************************************************************************************
+  * @brief      Space left in the transmit buffer of Serial
+  * @param      space Bytes that can be written without blocking
+  * @return     true
+  ********************************************************************************************** */
+bool Stm32Serial::availableForWrite(size_t& space) {
+  int available = Serial.availableForWrite();
+  space = available > 0 ? (size_t)available : 0;
+  return true;
+}
+
+/**************************************************************************************************
+  * @brief      Nothing to do, the UART driver drains its buffer on its own
+  * @return     true
+  ********************************************************************************************** */
+bool Stm32Serial::update() {
+  return true;
+}